@@ -0,0 +1,87 @@
+/************************************************************************************************
+* @file      : Implementation for Arguments class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The Arguments class splits the command-line args into positional arguments
+*              (the input video path) and named options. Options are written either as
+*              bare flags (--gate) or as key value pairs (--gate-threshold=2.5)
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "Arguments.hpp"
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+/***
+*@brief  : The constructor walks over all the command-line args. Anything that
+*          starts with "--" is stored as an option, where the text after an "="
+*          sign becomes the value. Bare flags are stored with an empty value.
+*          Everything else is kept in order as a positional arg.
+*@params : argc is the count of command-line args
+*@params : argv is the array of command-line args
+*****/
+Arguments::Arguments(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg.size() > 2 && arg.compare(0, 2, "--") == 0) {
+            auto split = arg.find('=');
+            if (split == std::string::npos) {
+                options[arg.substr(2)] = "";
+            } else {
+                options[arg.substr(2, split - 2)] = arg.substr(split + 1);
+            }
+        } else {
+            positionals.push_back(arg);
+        }
+    }
+}
+
+bool Arguments::has(const std::string& key) const {
+    return options.count(key) > 0;
+}
+
+std::string Arguments::getString(const std::string& key, \
+                                 const std::string& fallback) const {
+    auto item = options.find(key);
+    if (item == options.end() || item->second.empty())
+        return fallback;
+    return item->second;
+}
+
+double Arguments::getDouble(const std::string& key, double fallback) const {
+    auto item = options.find(key);
+    if (item == options.end() || item->second.empty())
+        return fallback;
+    return std::atof(item->second.c_str());
+}
+
+int Arguments::getInt(const std::string& key, int fallback) const {
+    auto item = options.find(key);
+    if (item == options.end() || item->second.empty())
+        return fallback;
+    return std::atoi(item->second.c_str());
+}
+
+const std::vector<std::string>& Arguments::positional() const {
+    return positionals;
+}
@@ -0,0 +1,117 @@
+/************************************************************************************************
+* @file      : Implementation for ChangeDetector class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ChangeDetector class is a cheap temporal coherence gate which decides
+*              whether a frame is similar enough to the last processed frame to reuse
+*              the previous lane polygon
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "ChangeDetector.hpp"
+#include <vector>
+#include <algorithm>
+
+/***
+*@brief  : The makeThumbnail() function crops the bounding box of the region of
+*          interest from the raw frame, converts the crop to gray and shrinks it
+*          by the scaling factor using area interpolation. The result is tiny
+*          (for example 110x27 pixels for a 720p frame) so that comparing two
+*          thumbnails costs next to nothing compared to the lanes pipeline.
+*@params : rawImg is the input image frame before any processing
+*@return : The downsampled gray thumbnail of the region of interest
+*****/
+cv::Mat ChangeDetector::makeThumbnail(cv::Mat rawImg) const {
+    cv::Rect box = cv::boundingRect(roiPoints) & \
+                   cv::Rect(0, 0, rawImg.cols, rawImg.rows);
+    cv::Mat gray;
+    if (rawImg.channels() == 3) {
+        cv::cvtColor(rawImg(box), gray, cv::COLOR_BGR2GRAY);
+    } else if (rawImg.channels() == 4) {
+        cv::cvtColor(rawImg(box), gray, cv::COLOR_BGRA2GRAY);
+    } else {
+        gray = rawImg(box);
+    }
+    cv::Mat thumbnail;
+    cv::resize(gray, thumbnail, cv::Size(std::max(1, box.width / scaleFactor), \
+               std::max(1, box.height / scaleFactor)), 0, 0, cv::INTER_AREA);
+    return thumbnail;
+}
+
+/***
+*@brief  : The isUnchanged() function compares the thumbnail of the new frame with
+*          the reference thumbnail. The reference is only replaced when a frame is
+*          sent through the full pipeline, so a slow drift over many frames still
+*          adds up and eventually triggers a new detection.
+*@params : rawImg is the input image frame before any processing
+*@return : true if the previous lane result can be reused
+*****/
+bool ChangeDetector::isUnchanged(cv::Mat rawImg) {
+    frames++;
+    cv::Mat thumbnail = makeThumbnail(rawImg);
+
+    if (!reference.empty() && reference.size() == thumbnail.size()) {
+        difference = cv::norm(thumbnail, reference, cv::NORM_L1) / \
+                     static_cast<double>(thumbnail.total());
+        if (difference < threshold && reuseCount < reuseLimit) {
+            reuseCount++;
+            reused++;
+            return true;
+        }
+    }
+
+    reference = thumbnail;
+    reuseCount = 0;
+    return false;
+}
+
+ChangeDetector::State ChangeDetector::state() const {
+    State saved;
+    saved.reference = reference.clone();
+    saved.reuseCount = reuseCount;
+    saved.frames = frames;
+    saved.reused = reused;
+    saved.difference = difference;
+    return saved;
+}
+
+void ChangeDetector::restore(const State& saved) {
+    reference = saved.reference.clone();
+    reuseCount = saved.reuseCount;
+    frames = saved.frames;
+    reused = saved.reused;
+    difference = saved.difference;
+}
+
+/***
+*@brief  : The report() function writes the number of checked frames and the
+*          number of short-circuited frames in a key: value format
+*@params : out is the stream on which the statistics are written
+*****/
+void ChangeDetector::report(std::ostream& out) const {
+    double ratio = frames > 0 ? 100.0 * reused / frames : 0.0;
+    out << "frames: " << frames << "\n"
+        << "reused_frames: " << reused << "\n"
+        << "processed_frames: " << frames - reused << "\n"
+        << "reused_percent: " << ratio << "\n"
+        << "threshold: " << threshold << "\n"
+        << "max_reuse: " << reuseLimit << std::endl;
+}
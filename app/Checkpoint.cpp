@@ -0,0 +1,247 @@
+/************************************************************************************************
+* @file      : Implementation of the Checkpoint class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The Checkpoint class writes and reads the state of a batch job as a YAML file. The file
+*              is written next to its final name and renamed over it, so a job stopped while writing
+*              it leaves the previous checkpoint intact.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "Checkpoint.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+
+namespace FS = boost::filesystem;    //! Short form for boost filesystem
+
+namespace {
+/***
+*@brief  : cv::FileStorage only stores 32 bit integers, so the 64 bit values
+*          are kept as text, the hash in hexadecimal
+*****/
+std::string hexText(uint64_t value) {
+    char text[17];
+    std::snprintf(text, sizeof(text), "%016llx", \
+                  static_cast<unsigned long long>(value));
+    return text;
+}
+
+bool readLong(const cv::FileNode& node, long long& value, int base = 10) {
+    if (!node.isString())
+        return false;
+    std::string text = static_cast<std::string>(node);
+    char *end = nullptr;
+    value = static_cast<long long>(std::strtoull(text.c_str(), &end, base));
+    return !text.empty() && *end == '\0';
+}
+
+void writeLine(cv::FileStorage& file, const std::string& key, \
+               const std::pair<cv::Point2d, cv::Point2d>& line) {
+    file << key << "[" << line.first << line.second << "]";
+}
+
+void readLine(const cv::FileNode& node, \
+              std::pair<cv::Point2d, cv::Point2d>& line) {
+    node[0] >> line.first;
+    node[1] >> line.second;
+}
+}  // namespace
+
+/***
+*@brief  : The save() function writes the checkpoint to a file of the same
+*          extension next to it, such as job.tmp.yml for job.yml, and renames
+*          it over the checkpoint
+*****/
+bool Checkpoint::save(const std::string& path, std::string& error) const {
+    FS::path target(path);
+    FS::path temporary = target.parent_path() / \
+        (target.stem().string() + ".tmp" + target.extension().string());
+    cv::FileStorage file(temporary.string(), cv::FileStorage::WRITE);
+    if (!file.isOpened()) {
+        error = "cannot write " + temporary.string();
+        return false;
+    }
+    file << "input" << input;
+    file << "settings" << hexText(settings);
+    file << "frames" << static_cast<int>(frames);
+    file << "complete" << static_cast<int>(complete);
+    file << "detect_seconds" << detectSeconds;
+    file << "outputs" << "[";
+    for (const Output& output : outputs) {
+        file << "{" << "path" << output.path \
+             << "bytes" << std::to_string(output.bytes) << "}";
+    }
+    file << "]";
+
+    const LaneStream::State& lanes = pipeline.lanes;
+    file << "lanes" << "{";
+    file << "counter" << static_cast<int>(lanes.counter);
+    file << "proc_size" << lanes.procSize;
+    file << "historic_lane" << lanes.historicLane;
+    file << "older_lane" << lanes.olderLane;
+    writeLine(file, "left_line", lanes.leftLine);
+    writeLine(file, "right_line", lanes.rightLine);
+    file << "fits" << "[";
+    for (int i = 0; i < 3; i++)
+        file << lanes.leftFit[i];
+    for (int i = 0; i < 3; i++)
+        file << lanes.rightFit[i];
+    file << "]";
+    file << "tracking" << static_cast<int>(lanes.tracking);
+    file << "times" << "[" << lanes.times.prepare << lanes.times.threshold \
+         << lanes.times.edges << lanes.times.hough << lanes.times.polygon \
+         << "]";
+    file << "timed_frames" << static_cast<int>(lanes.times.frames);
+    file << "}";
+
+    if (pipeline.gated) {
+        const ChangeDetector::State& gate = pipeline.gate;
+        file << "gate" << "{";
+        file << "frame_size" << pipeline.frameSize;
+        file << "reference" << gate.reference;
+        file << "reuse_count" << gate.reuseCount;
+        file << "frames" << static_cast<int>(gate.frames);
+        file << "reused" << static_cast<int>(gate.reused);
+        file << "difference" << gate.difference;
+        file << "}";
+    }
+    file.release();
+
+    if (std::rename(temporary.string().c_str(), path.c_str()) != 0) {
+        error = "cannot replace " + path;
+        return false;
+    }
+    return true;
+}
+
+bool Checkpoint::load(const std::string& path, std::string& error) {
+    cv::FileStorage file;
+    try {
+        file.open(path, cv::FileStorage::READ);
+    } catch (const cv::Exception& failure) {
+        error = path + ": " + failure.what();
+        return false;
+    }
+    if (!file.isOpened()) {
+        error = "cannot read " + path;
+        return false;
+    }
+    long long hash = 0;
+    if (!file["input"].isString() || \
+        !readLong(file["settings"], hash, 16) || \
+        !file["frames"].isInt() || !file["lanes"].isMap()) {
+        error = path + " is not a checkpoint";
+        return false;
+    }
+    input = static_cast<std::string>(file["input"]);
+    settings = static_cast<uint64_t>(hash);
+    frames = static_cast<int>(file["frames"]);
+    complete = static_cast<int>(file["complete"]) != 0;
+    detectSeconds = static_cast<double>(file["detect_seconds"]);
+    outputs.clear();
+    cv::FileNode list = file["outputs"];
+    for (cv::FileNodeIterator it = list.begin(); it != list.end(); ++it) {
+        Output output;
+        output.path = static_cast<std::string>((*it)["path"]);
+        if (!readLong((*it)["bytes"], output.bytes)) {
+            error = path + ": malformed output " + output.path;
+            return false;
+        }
+        outputs.push_back(output);
+    }
+
+    cv::FileNode node = file["lanes"];
+    LaneStream::State& lanes = pipeline.lanes;
+    lanes.counter = static_cast<int>(node["counter"]);
+    node["proc_size"] >> lanes.procSize;
+    node["historic_lane"] >> lanes.historicLane;
+    node["older_lane"] >> lanes.olderLane;
+    readLine(node["left_line"], lanes.leftLine);
+    readLine(node["right_line"], lanes.rightLine);
+    std::vector<double> fits, times;
+    node["fits"] >> fits;
+    node["times"] >> times;
+    if (lanes.historicLane.size() != 4 || lanes.olderLane.size() != 4 || \
+        fits.size() != 6 || times.size() != 5) {
+        error = path + ": malformed lane history";
+        return false;
+    }
+    lanes.leftFit = cv::Vec3d(fits[0], fits[1], fits[2]);
+    lanes.rightFit = cv::Vec3d(fits[3], fits[4], fits[5]);
+    lanes.tracking = static_cast<int>(node["tracking"]) != 0;
+    lanes.times.prepare = times[0];
+    lanes.times.threshold = times[1];
+    lanes.times.edges = times[2];
+    lanes.times.hough = times[3];
+    lanes.times.polygon = times[4];
+    lanes.times.frames = static_cast<int>(node["timed_frames"]);
+
+    cv::FileNode gate = file["gate"];
+    pipeline.gated = gate.isMap();
+    if (pipeline.gated) {
+        gate["frame_size"] >> pipeline.frameSize;
+        gate["reference"] >> pipeline.gate.reference;
+        pipeline.gate.reuseCount = static_cast<int>(gate["reuse_count"]);
+        pipeline.gate.frames = static_cast<int>(gate["frames"]);
+        pipeline.gate.reused = static_cast<int>(gate["reused"]);
+        pipeline.gate.difference = static_cast<double>(gate["difference"]);
+    }
+    return true;
+}
+
+/***
+*@brief  : The matches() function also checks that every output which is
+*          continued still holds the bytes the checkpoint counted
+*****/
+bool Checkpoint::matches(const std::string& source, uint64_t settingsHash, \
+                         const std::vector<std::string>& paths, \
+                         std::string& error) const {
+    if (source != input) {
+        error = "the checkpoint belongs to " + input;
+        return false;
+    }
+    if (settingsHash != settings) {
+        error = "the checkpoint was written with other detection settings";
+        return false;
+    }
+    if (paths.size() != outputs.size()) {
+        error = "the checkpoint was written with other outputs";
+        return false;
+    }
+    for (size_t i = 0; i < paths.size(); i++) {
+        if (paths[i] != outputs[i].path) {
+            error = "the checkpoint was written to " + outputs[i].path;
+            return false;
+        }
+        if (outputs[i].bytes < 0)
+            continue;
+        boost::system::error_code failure;
+        uintmax_t size = FS::file_size(outputs[i].path, failure);
+        if (failure || size < static_cast<uintmax_t>(outputs[i].bytes)) {
+            error = outputs[i].path + " is shorter than at the checkpoint";
+            return false;
+        }
+    }
+    return true;
+}
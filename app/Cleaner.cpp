@@ -5,7 +5,9 @@
 *              image frames:
 *                1.) Undistort the input image frame using camera parameters and distortion
 *                    coefficients; and
-*                2.) Smoothen the undistorted image using a gaussian filter.
+*                2.) Smoothen the undistorted image using a gaussian filter; and
+*                3.) Warp the road area into an undistorted top-down view with
+*                    a single remap.
 * @date      : October 8, 2018
 * @copyright : 2018, Arun Kumar Devarajulu
 * @license   : MIT License
@@ -33,27 +35,126 @@
 #include "Cleaner.hpp"
 
 /***
-* @brief  : The imgUndistort function takes in the raw image and undistorts the image
-*           using cv::undistort() function. The parameters camParams, distCoeffs are
-*           initialised by the Class constructor
+* @brief  : The imgUndistort function takes in the raw image and undistorts the image.
+*           cv::undistort() builds the same CV_16SC2 maps and calls cv::remap() on
+*           every call, so we build the maps once per image size with the camParams
+*           and distCoeffs initialised by the Class constructor and only remap,
+*           which gives the same output
 * @params : The parameter rawImg is the input image frame
 ****/
 void Cleaner::imgUndistort(cv::Mat rawImg) {
     rawImage = rawImg;
-    cv::undistort(rawImage, undistortedImage, camParams, distCoeffs);
+    prepareMaps(rawImage.size());
+    cv::remap(rawImage, undistortedImage, undistortMap1, undistortMap2, \
+              cv::INTER_LINEAR, cv::BORDER_CONSTANT);
 }
 
 /***
 * @brief  : The imgSmoothen function creates a new image which is a gaussin blurred version
 *           of the undistorted image. For this we first create a matrix of zeros of the size
 *           and type of undistorted image. Later we pass this matrix to the cv::GaussianBlur()
-*           function. A kernel size of (5, 5) is used here. At the end of the GaussianBlur
-*           operation, the blurImage will be a an undistorted image with a Gaussian Blur.
+*           function. The kernel size comes from the constructor, (5, 5) by default.
+*           At the end of the GaussianBlur operation, the blurImage will be a an
+*           undistorted image with a Gaussian Blur.
 * @return : The blured image
 ****/
 cv::Mat Cleaner::imgSmoothen() {
     blurImage = cv::Mat::zeros(undistortedImage.size(), \
                                undistortedImage.type());
-    cv::GaussianBlur(undistortedImage, blurImage, cv::Size(5, 5), 0, 0);
+    smoothen(undistortedImage, blurImage);
     return blurImage;
 }
+
+void Cleaner::prepareMaps(cv::Size size) {
+    if (mapSize != size) {
+        cv::initUndistortRectifyMap(camParams, distCoeffs, cv::Mat(), \
+                                    camParams, size, CV_16SC2, \
+                                    undistortMap1, undistortMap2);
+        mapSize = size;
+    }
+}
+
+/***
+* @brief  : The remapRows function looks up the rows of the maps only. Every
+*           output pixel of cv::remap depends on its own map entries alone, so
+*           a band of rows is identical to the same rows of the whole image.
+****/
+void Cleaner::remapRows(const cv::Mat& rawImg, int first, int last, \
+                        cv::Mat& dst) const {
+    cv::remap(rawImg, dst, undistortMap1.rowRange(first, last), \
+              undistortMap2.rowRange(first, last), cv::INTER_LINEAR, \
+              cv::BORDER_CONSTANT);
+}
+
+void Cleaner::smoothen(const cv::Mat& src, cv::Mat& dst) const {
+    cv::GaussianBlur(src, dst, cv::Size(kernelSize, kernelSize), 0, 0);
+}
+
+/***
+* @brief  : cv::initUndistortRectifyMap maps every output pixel through the
+*           inverse of newCameraMatrix * R before it applies the lens model and
+*           the camera matrix. With R = H * camParams and an identity new camera
+*           matrix, an output pixel goes through camParams^-1 * H^-1, which is
+*           the undistorted frame pixel of the view pixel in normalized camera
+*           co-ordinates, so one table holds both warps and one cv::remap
+*           replaces the undistortion and a cv::warpPerspective pass. The table
+*           only has entries for the view pixels, so only the road area is
+*           ever read from the raw image.
+* @params : roadQuad are the road corners in undistorted frame pixels
+* @params : size is the size of the top-down view
+****/
+void Cleaner::setBirdsEye(const std::vector<cv::Point2f>& roadQuad, \
+                          cv::Size size) {
+    CV_Assert(roadQuad.size() == 4 && size.area() > 0);
+    const float width = static_cast<float>(size.width);
+    const float height = static_cast<float>(size.height);
+    std::vector<cv::Point2f> corners = {cv::Point2f(0, 0), \
+                                        cv::Point2f(width, 0), \
+                                        cv::Point2f(width, height), \
+                                        cv::Point2f(0, height)};
+    viewTransform = cv::getPerspectiveTransform(roadQuad, corners);
+    cv::Mat camera;
+    camParams.convertTo(camera, CV_64F);
+    cv::Mat composite = viewTransform * camera;
+    cv::initUndistortRectifyMap(camParams, distCoeffs, composite, \
+                                cv::Mat::eye(3, 3, CV_64F), size, CV_16SC2, \
+                                viewMap1, viewMap2);
+    viewSize = size;
+}
+
+void Cleaner::birdsEye(const cv::Mat& rawImg, cv::Mat& view) const {
+    CV_Assert(hasBirdsEye());
+    cv::remap(rawImg, view, viewMap1, viewMap2, cv::INTER_LINEAR, \
+              cv::BORDER_CONSTANT);
+}
+
+std::vector<cv::Point2f> Cleaner::viewToFrame(\
+    const std::vector<cv::Point2f>& points) const {
+    std::vector<cv::Point2f> framePoints;
+    if (!points.empty()) {
+        cv::perspectiveTransform(points, framePoints, viewTransform.inv());
+    }
+    return framePoints;
+}
+
+std::vector<cv::Point2f> Cleaner::frameToView(\
+    const std::vector<cv::Point2f>& points) const {
+    std::vector<cv::Point2f> viewPoints;
+    if (!points.empty()) {
+        cv::perspectiveTransform(points, viewPoints, viewTransform);
+    }
+    return viewPoints;
+}
+
+/***
+* @brief  : The viewToFrame function looks every frame pixel up in the view
+*           through the homography, so frame pixels outside the road area stay
+*           zero. Nearest neighbour lookups keep the values of masks intact.
+****/
+void Cleaner::viewToFrame(const cv::Mat& view, cv::Size frameSize, \
+                          cv::Mat& frame) const {
+    CV_Assert(hasBirdsEye() && view.size() == viewSize);
+    cv::warpPerspective(view, frame, viewTransform, frameSize, \
+                        cv::INTER_NEAREST | cv::WARP_INVERSE_MAP, \
+                        cv::BORDER_CONSTANT);
+}
@@ -0,0 +1,193 @@
+/************************************************************************************************
+* @file      : Implementation of the CoreScheduler class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The CoreScheduler class pins threads with the Linux affinity calls and samples the busy
+*              and total time of every core from /proc/stat. On other systems nothing is pinned and no
+*              utilization is reported.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include "CoreScheduler.hpp"
+
+namespace {
+/***
+*@brief  : The readTimes() function reads the busy and total ticks of the
+*          given cores from /proc/stat, zero for a core it does not list
+*****/
+void readTimes(const std::vector<int>& cores, \
+               std::vector<unsigned long long>& busy, \
+               std::vector<unsigned long long>& total) {
+    busy.assign(cores.size(), 0);
+    total.assign(cores.size(), 0);
+    std::ifstream stat("/proc/stat");
+    std::string line;
+    while (std::getline(stat, line)) {
+        if (line.compare(0, 3, "cpu") != 0 || line.size() < 4 || \
+            line[3] < '0' || line[3] > '9')
+            continue;
+        std::istringstream fields(line.substr(3));
+        int core;
+        // user nice system idle iowait irq softirq steal
+        unsigned long long ticks[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        fields >> core;
+        for (int i = 0; i < 8; i++)
+            fields >> ticks[i];
+        auto slot = std::find(cores.begin(), cores.end(), core);
+        if (slot == cores.end())
+            continue;
+        size_t index = static_cast<size_t>(slot - cores.begin());
+        for (int i = 0; i < 8; i++)
+            total[index] += ticks[i];
+        busy[index] = total[index] - ticks[3] - ticks[4];
+    }
+}
+}  // namespace
+
+CoreScheduler::CoreScheduler(const std::vector<int>& cores, int budget) {
+    std::vector<int> used = cores;
+    if (used.empty())
+        used.push_back(0);
+    if (budget > 0 && static_cast<size_t>(budget) < used.size())
+        used.resize(static_cast<size_t>(budget));
+    if (used.size() == 1) {
+        detectCores = used;
+        auxiliaryCores = used;
+        return;
+    }
+    size_t auxiliaryCount = std::max<size_t>(1, used.size() / 4);
+    detectCores.assign(used.begin(), used.end() - auxiliaryCount);
+    auxiliaryCores.assign(used.end() - auxiliaryCount, used.end());
+}
+
+/***
+*@brief  : The parseCores() function accepts comma separated core numbers
+*          and inclusive ranges, and drops duplicates
+*****/
+bool CoreScheduler::parseCores(const std::string& text, \
+                               std::vector<int>& cores) {
+    std::vector<int> parsed;
+    std::istringstream list(text);
+    std::string item;
+    while (std::getline(list, item, ',')) {
+        char *end = nullptr;
+        long first = std::strtol(item.c_str(), &end, 10);
+        long last = first;
+        if (end == item.c_str())
+            return false;
+        if (*end == '-') {
+            const char *from = end + 1;
+            last = std::strtol(from, &end, 10);
+            if (end == from)
+                return false;
+        }
+        if (*end != '\0' || first < 0 || last < first || last > 4095)
+            return false;
+        for (long core = first; core <= last; core++)
+            parsed.push_back(static_cast<int>(core));
+    }
+    std::sort(parsed.begin(), parsed.end());
+    parsed.erase(std::unique(parsed.begin(), parsed.end()), parsed.end());
+    if (parsed.empty())
+        return false;
+    cores = parsed;
+    return true;
+}
+
+std::vector<int> CoreScheduler::available() {
+    std::vector<int> cores;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int core = 0; core < CPU_SETSIZE; core++) {
+            if (CPU_ISSET(core, &set))
+                cores.push_back(core);
+        }
+    }
+#endif
+    if (cores.empty())
+        cores.push_back(0);
+    return cores;
+}
+
+bool CoreScheduler::pinCurrent(const std::vector<int>& cores) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int core : cores) {
+        if (core >= 0 && core < CPU_SETSIZE)
+            CPU_SET(core, &set);
+    }
+    return CPU_COUNT(&set) > 0 && \
+           pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cores;
+    return false;
+#endif
+}
+
+int CoreScheduler::opencvThreads(bool pooled) const {
+    return pooled ? 0 : static_cast<int>(detectCores.size());
+}
+
+void CoreScheduler::start() {
+    std::vector<int> cores = detectCores;
+    cores.insert(cores.end(), auxiliaryCores.begin(), auxiliaryCores.end());
+    readTimes(cores, busyStart, totalStart);
+}
+
+/***
+*@brief  : The report() function counts the ticks of other processes too,
+*          since those are what co-located services take from the job
+*****/
+void CoreScheduler::report(std::ostream& out) const {
+    std::vector<int> cores = detectCores;
+    cores.insert(cores.end(), auxiliaryCores.begin(), auxiliaryCores.end());
+    std::vector<unsigned long long> busy, total;
+    readTimes(cores, busy, total);
+    bool shared = detectCores == auxiliaryCores;
+    for (size_t i = 0; i < cores.size(); i++) {
+        if (shared && i >= detectCores.size())
+            break;
+        const char *role = shared ? "detection and auxiliary" : \
+                           (i < detectCores.size() ? "detection" : \
+                                                     "auxiliary");
+        out << "Core " << cores[i] << " (" << role << "): ";
+        if (i >= totalStart.size() || total[i] <= totalStart[i]) {
+            out << "no samples" << std::endl;
+            continue;
+        }
+        double used = static_cast<double>(busy[i]) - busyStart[i];
+        out << 100.0 * std::max(0.0, used) / (total[i] - totalStart[i]) \
+            << " % busy" << std::endl;
+    }
+}
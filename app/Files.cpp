@@ -45,6 +45,9 @@
 #include <ostream>
 #include <iomanip>
 #include <cmath>
+#include <cctype>
+#include <cstdint>
+#include <stdexcept>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem/operations.hpp>
@@ -54,7 +57,7 @@ namespace FS = boost::filesystem;   // !Short form for boost filesystem
 // @Brief: We create some short forms for long type names
 
 // Short form for file name pairs (for example, <200.jpg, 200>)
-typedef std::pair<FS::path, int> file_entry;
+typedef std::pair<FS::path, uint64_t> file_entry;
 // Short form for vector of tuples
 typedef std::vector<file_entry> vec;
 // Short form for iterator of type, boost::filesystem::directory_iterator
@@ -97,14 +100,57 @@ std::string Files::filePicker(std::string commandArgs) {
 
 // Next we create a string to integer conversion method that
 // sorts the numerical file names in ascending order.
-// The return type for this method is "int"
-int Files::stringToInt(FS::path const& pathObj) {
-    return std::stoi(pathObj.filename().string());
+// It returns false for files without a number
+bool Files::stringToInt(FS::path const& pathObj, uint64_t& key) {
+    return frameKey(pathObj.filename().string(), key);
+}
+
+// The frameKey method reads the last run of digits before the extension,
+// so "200.jpg", "frame_0200.jpg" and "cam2_0200.jpg" all give 200.
+// Numbers beyond the range of uint64_t are not frame numbers
+bool Files::frameKey(const std::string& fileName, uint64_t& key) {
+    size_t end = fileName.find_last_of('.');
+    if (end == std::string::npos || end == 0)
+        end = fileName.size();
+    size_t last = end;
+    while (last > 0 && !std::isdigit(static_cast<unsigned char> \
+                                     (fileName[last - 1])))
+        last--;
+    size_t first = last;
+    while (first > 0 && std::isdigit(static_cast<unsigned char> \
+                                     (fileName[first - 1])))
+        first--;
+    if (first == last)
+        return false;
+    try {
+        key = std::stoull(fileName.substr(first, last - first));
+    } catch (const std::out_of_range&) {
+        return false;
+    }
+    return true;
+}
+
+// The isImageFile method compares the extension without regard to case
+bool Files::isImageFile(const std::string& fileName) {
+    static const char* const extensions[] = {
+        "jpg", "jpeg", "png", "bmp", "tif", "tiff"
+    };
+    size_t dot = fileName.find_last_of('.');
+    if (dot == std::string::npos || dot == 0)
+        return false;
+    std::string extension = fileName.substr(dot + 1);
+    for (auto& c : extension)
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    for (const char* known : extensions) {
+        if (extension == known)
+            return true;
+    }
+    return false;
 }
 
 // Next we create a path sorting method that sorts the path_vector
 // into ascending order of files for accessing files in the right order
-std::vector<std::pair<boost::filesystem::path, int>> \
+std::vector<std::pair<boost::filesystem::path, uint64_t>> \
 Files::pathSorter(FS::path const& pathObj) {
     // First we ensure that our path_vec is a clean container
     path_vec.clear();
@@ -113,7 +159,11 @@ Files::pathSorter(FS::path const& pathObj) {
     // Here "stringToInt" method is used to create the second item (integer)
     // of the "path_vec" vector items
     for (dirIter it(pathObj); it != FS::directory_iterator(); ++it) {
-        path_vec.emplace_back(*it, stringToInt(*it));
+        std::string name = it->path().filename().string();
+        uint64_t key;
+        if (!stringToInt(it->path(), key) || !isImageFile(name))
+            continue;
+        path_vec.emplace_back(*it, key);
     }
 
     // Then we sort the previous "path" vector using
@@ -123,5 +173,5 @@ Files::pathSorter(FS::path const& pathObj) {
         return a.second < b.second;
     });
     return path_vec;   //< Return the sorted path vector
-                       //  of pairs with type <path, int>
+                       //  of pairs with type <path, uint64_t>
 }
@@ -0,0 +1,112 @@
+/************************************************************************************************
+* @file      : Benchmark for listing large frame directories
+* @author    : Arun Kumar Devarajulu
+* @brief     : The files-bench tool compares Files::pathSorter with the streaming
+*              FrameEnumerator on a directory of numbered frames. Usage:
+*                files-bench <directory> [--count=N] [--first=N]
+*              When the directory does not exist it is created with N empty frames named
+*              frame_0000000.jpg onwards (one million by default) and a .DS_Store file.
+*              It prints the time to the first frame, the time to the last frame and the
+*              memory held by the listing for both approaches.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include "Arguments.hpp"
+#include "Files.hpp"
+#include "FrameEnumerator.hpp"
+
+namespace {
+typedef std::chrono::steady_clock Clock;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/***
+*@brief  : Fills a new directory with empty numbered frames
+*****/
+void makeFrames(const std::string& directory, int count, int first) {
+    FS::create_directories(directory);
+    std::ofstream(directory + "/.DS_Store");
+    char name[32];
+    for (int i = 0; i < count; i++) {
+        std::snprintf(name, sizeof(name), "/frame_%07d.jpg", first + i);
+        std::ofstream(directory + name);
+    }
+}
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    Arguments args(argc, argv);
+    if (args.positional().empty()) {
+        std::cout << "Usage: files-bench <directory> [--count=N] [--first=N]" \
+                  << std::endl;
+        return -1;
+    }
+    std::string directory = args.positional().front();
+    int first = args.getInt("first", 0);
+    if (!FS::exists(directory)) {
+        int count = args.getInt("count", 1000000);
+        std::cout << "Creating " << count << " frames in " << directory \
+                  << std::endl;
+        makeFrames(directory, count, first);
+    }
+
+    // Listing, parsing and sorting every entry before the first frame
+    Files location;
+    Clock::time_point start = Clock::now();
+    std::vector<std::pair<FS::path, uint64_t>> sorted = \
+        location.pathSorter(directory);
+    double sortedSeconds = secondsSince(start);
+    size_t sortedBytes = sorted.capacity() * sizeof(sorted[0]);
+    for (auto& entry : sorted)
+        sortedBytes += entry.first.native().capacity() + 1;
+    std::cout << "pathSorter      : " << sorted.size() << " frames, first " \
+              << "after " << sortedSeconds << " s, last after " \
+              << sortedSeconds << " s, " << sortedBytes / 1024 << " KiB" \
+              << std::endl;
+    sorted.clear();
+    sorted.shrink_to_fit();
+
+    // Streaming the entries while the directory is still being listed
+    start = Clock::now();
+    FrameEnumerator frames(directory, static_cast<uint64_t>(first));
+    std::string path;
+    size_t count = 0;
+    double firstSeconds = 0;
+    while (frames.next(path)) {
+        if (count++ == 0)
+            firstSeconds = secondsSince(start);
+    }
+    std::cout << "FrameEnumerator : " << count << " frames, first after " \
+              << firstSeconds << " s, last after " << secondsSince(start) \
+              << " s, " << frames.memoryBytes() / 1024 << " KiB, " \
+              << frames.skipped() << " skipped" << std::endl;
+    return 0;
+}
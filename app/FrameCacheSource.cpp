@@ -0,0 +1,262 @@
+/************************************************************************************************
+* @file      : Implementation for FrameCacheSource class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The FrameCacheSource class writes and maps raw frame cache files
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "FrameCacheSource.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "FrameView.hpp"
+#include "LanePipeline.hpp"
+
+namespace {
+/***
+*@brief  : Returns the PixelFormat of an 8 bit image, or -1 for other images
+*****/
+int pixelFormat(const cv::Mat& frame) {
+    if (frame.depth() != CV_8U)
+        return -1;
+    switch (frame.channels()) {
+        case 1: return PIXEL_GRAY;
+        case 3: return PIXEL_BGR;
+        case 4: return PIXEL_BGRA;
+        default: return -1;
+    }
+}
+}  // namespace
+
+/***
+*@brief  : The constructor maps the whole file and checks the header and every
+*          index entry once, so that read() never has to
+*@params : path is the location of the frame cache file
+*****/
+FrameCacheSource::FrameCacheSource(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        lastError = "cannot open " + path;
+        return;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || \
+            static_cast<size_t>(info.st_size) < sizeof(FrameCacheHeader)) {
+        ::close(fd);
+        lastError = path + " is too small for a frame cache file";
+        return;
+    }
+    mappedBytes = static_cast<size_t>(info.st_size);
+    mapping = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, \
+                   MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        mappedBytes = 0;
+        lastError = "cannot map " + path;
+        return;
+    }
+
+    const FrameCacheHeader *header = \
+        static_cast<const FrameCacheHeader *>(mapping);
+    uint64_t frameBytes = uint64_t(header->stride) * \
+                          planeRows(header->format, header->height);
+    if (std::memcmp(header->magic, kFrameCacheMagic, \
+                    sizeof(kFrameCacheMagic)) != 0 || \
+            header->version != kFrameCacheVersion || \
+            header->headerSize != sizeof(FrameCacheHeader) || \
+            header->entrySize != sizeof(FrameCacheEntry) || \
+            pixelBytes(header->format) == 0 || \
+            header->stride < uint64_t(header->width) * \
+                             pixelBytes(header->format) || \
+            header->frameCount == 0 || header->indexOffset > mappedBytes || \
+            frameBytes == 0 || frameBytes > header->indexOffset || \
+            header->frameCount > (mappedBytes - header->indexOffset) / \
+                                 sizeof(FrameCacheEntry)) {
+        release();
+        lastError = path + " is not a complete frame cache file";
+        return;
+    }
+    entries = reinterpret_cast<const FrameCacheEntry *>( \
+              static_cast<const char *>(mapping) + header->indexOffset);
+    for (uint64_t i = 0; i < header->frameCount; i++) {
+        if (entries[i].offset < sizeof(FrameCacheHeader) || \
+            entries[i].offset > header->indexOffset - frameBytes) {
+            release();
+            lastError = path + " has a damaged frame index";
+            return;
+        }
+    }
+    fileHeader = header;
+    frameCount = static_cast<size_t>(header->frameCount);
+    // Benchmarks read the frames in order, so we ask for read-ahead
+    madvise(mapping, mappedBytes, MADV_SEQUENTIAL);
+}
+
+bool FrameCacheSource::read(cv::Mat& frame) {
+    if (fileHeader == nullptr || nextFrame >= frameCount)
+        return false;
+    unsigned char *pixels = static_cast<unsigned char *>(mapping) + \
+                            entries[nextFrame++].offset;
+    frame = cv::Mat(planeRows(fileHeader->format, fileHeader->height), \
+                    fileHeader->width, \
+                    CV_8UC(pixelBytes(fileHeader->format)), pixels, \
+                    fileHeader->stride);
+    return true;
+}
+
+/***
+*@brief  : The skip() function only moves the position, every frame is at a
+*          known offset of the mapping
+*****/
+long FrameCacheSource::skip(long count) {
+    if (fileHeader == nullptr || count <= 0)
+        return 0;
+    size_t skipped = std::min(static_cast<size_t>(count), \
+                              frameCount - std::min(nextFrame, frameCount));
+    nextFrame += skipped;
+    return static_cast<long>(skipped);
+}
+
+cv::Size FrameCacheSource::frameSize() const {
+    if (fileHeader == nullptr)
+        return cv::Size();
+    return cv::Size(fileHeader->width, fileHeader->height);
+}
+
+double FrameCacheSource::fps() const {
+    return fileHeader != nullptr ? fileHeader->fps : 0;
+}
+
+int FrameCacheSource::format() const {
+    return fileHeader != nullptr ? static_cast<int>(fileHeader->format) : -1;
+}
+
+void FrameCacheSource::release() {
+    if (mapping != nullptr)
+        munmap(mapping, mappedBytes);
+    mapping = nullptr;
+    mappedBytes = 0;
+    fileHeader = nullptr;
+    entries = nullptr;
+    frameCount = 0;
+    nextFrame = 0;
+}
+
+bool FrameCacheSource::isCache(const std::string& path) {
+    char magic[sizeof(kFrameCacheMagic)];
+    std::ifstream file(path, std::ios::binary);
+    return file.read(magic, sizeof(magic)) && \
+           std::memcmp(magic, kFrameCacheMagic, sizeof(magic)) == 0;
+}
+
+/***
+*@brief  : The build() function writes the header with a zero frame count
+*          first and completes it after the index, so that an interrupted
+*          build never looks like a valid file
+*****/
+long FrameCacheSource::build(FrameSource& source, const std::string& path, \
+                             std::string& error, int format) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        error = "cannot create " + path;
+        return -1;
+    }
+    FrameCacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kFrameCacheMagic, sizeof(kFrameCacheMagic));
+    header.version = kFrameCacheVersion;
+    header.headerSize = sizeof(FrameCacheHeader);
+    header.entrySize = sizeof(FrameCacheEntry);
+    header.fps = source.fps();
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    std::vector<char> padding(kFrameCacheAlignment, 0);
+    file.write(padding.data(), kFrameCacheAlignment - sizeof(header));
+    std::vector<FrameCacheEntry> index;
+    uint64_t offset = kFrameCacheAlignment;
+    cv::Mat frame;
+    while (error.empty() && source.read(frame)) {
+        int frameFormat = source.format() >= 0 ? source.format() : \
+                          pixelFormat(frame);
+        if (format == PIXEL_NV12 && frameFormat == PIXEL_BGR) {
+            frame = LanePipeline::nv12(frame);
+            frameFormat = PIXEL_NV12;
+        }
+        int height = frameFormat == PIXEL_NV12 ? frame.rows / 3 * 2 : \
+                                                 frame.rows;
+        size_t rowBytes = frame.cols * frame.elemSize();
+        if (frameFormat < 0 || (format == PIXEL_NV12 && \
+                                frameFormat != PIXEL_NV12)) {
+            error = "only 8 bit gray, BGR, BGRA and NV12 frames can be cached";
+        } else if (index.empty()) {
+            header.width = frame.cols;
+            header.height = height;
+            header.format = frameFormat;
+            header.stride = static_cast<uint32_t>(rowBytes);
+        } else if (header.width != uint32_t(frame.cols) || \
+                   header.height != uint32_t(height) || \
+                   header.format != uint32_t(frameFormat)) {
+            error = "the frames of the source change their size or format";
+        }
+        if (!error.empty())
+            break;
+        for (int row = 0; row < frame.rows; row++)
+            file.write(frame.ptr<char>(row), rowBytes);
+        uint64_t frameBytes = uint64_t(rowBytes) * frame.rows;
+        uint64_t gap = (kFrameCacheAlignment - \
+                        frameBytes % kFrameCacheAlignment) % \
+                       kFrameCacheAlignment;
+        file.write(padding.data(), gap);
+        FrameCacheEntry entry;
+        entry.offset = offset;
+        entry.sourceFrame = index.size();
+        index.push_back(entry);
+        offset += frameBytes + gap;
+    }
+    if (error.empty() && index.empty())
+        error = "the source has no frames";
+    if (error.empty()) {
+        file.write(reinterpret_cast<const char *>(index.data()), \
+                   index.size() * sizeof(FrameCacheEntry));
+        header.frameCount = index.size();
+        header.indexOffset = offset;
+        file.seekp(0);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.close();
+        if (!file)
+            error = "cannot write " + path;
+    }
+    if (!error.empty()) {
+        file.close();
+        std::remove(path.c_str());
+        return -1;
+    }
+    return static_cast<long>(index.size());
+}
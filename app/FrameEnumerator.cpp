@@ -0,0 +1,191 @@
+/************************************************************************************************
+* @file      : Implementation for FrameEnumerator class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The FrameEnumerator class lists a directory of numbered images on a background
+*              thread and hands out the image paths in frame order
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "FrameEnumerator.hpp"
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <boost/filesystem.hpp>
+#include "Files.hpp"
+
+namespace {
+// Number of entries listed before they are handed to the shared heap
+const size_t kBatchSize = 4096;
+}  // namespace
+
+FrameEnumerator::FrameEnumerator(const std::string& directory, \
+                                 uint64_t firstKey) : \
+    folder(directory), expected(firstKey) {
+    lister = std::thread(&FrameEnumerator::scan, this);
+}
+
+FrameEnumerator::~FrameEnumerator() {
+    {
+        std::lock_guard<std::mutex> lock(listMutex);
+        stopping = true;
+    }
+    if (lister.joinable())
+        lister.join();
+}
+
+/***
+*@brief  : The scan() function reads the directory one entry at a time without
+*          building boost paths for the entries, keeps the numbered images and
+*          passes them on in batches so that the lock is taken rarely. It
+*          ends early when the enumerator is destroyed before the listing is
+*          complete.
+*****/
+void FrameEnumerator::scan() {
+    std::vector<Entry> batch;
+    std::string batchNames;
+    size_t rejected = 0;
+    boost::system::error_code error;
+    FS::directory_iterator it(folder, error), end;
+    for (; !error && it != end; it.increment(error)) {
+        if (stopping)
+            break;
+        const std::string name = it->path().filename().string();
+        uint64_t key;
+        if (!Files::isImageFile(name) || !Files::frameKey(name, key)) {
+            rejected++;
+            continue;
+        }
+        Entry entry;
+        entry.key = key;
+        entry.nameOffset = static_cast<uint32_t>(batchNames.size());
+        entry.nameLength = static_cast<uint32_t>(name.size());
+        batchNames += name;
+        batch.push_back(entry);
+        if (batch.size() >= kBatchSize) {
+            {
+                std::lock_guard<std::mutex> lock(listMutex);
+                skippedCount += rejected;
+            }
+            rejected = 0;
+            merge(batch, batchNames);
+        }
+    }
+    if (error)
+        std::cout << "Error listing " << folder << ": " \
+                  << error.message() << std::endl;
+    {
+        std::lock_guard<std::mutex> lock(listMutex);
+        skippedCount += rejected;
+    }
+    merge(batch, batchNames);
+    {
+        std::lock_guard<std::mutex> lock(listMutex);
+        done = true;
+    }
+    listChanged.notify_all();
+}
+
+void FrameEnumerator::merge(std::vector<Entry>& batch, \
+                            std::string& batchNames) {
+    {
+        std::lock_guard<std::mutex> lock(listMutex);
+        const uint32_t base = static_cast<uint32_t>(names.size());
+        names += batchNames;
+        for (Entry entry : batch) {
+            entry.nameOffset += base;
+            pending.push_back(entry);
+            std::push_heap(pending.begin(), pending.end(), Later());
+        }
+        acceptedCount += batch.size();
+    }
+    batch.clear();
+    batchNames.clear();
+    listChanged.notify_all();
+}
+
+/***
+*@brief  : The next() function hands out the smallest frame number seen so far
+*          if it is the one expected next (or a duplicate of the last one), or
+*          anything once the listing is complete. Frames numbered below the
+*          last one handed out can only show up when the sequence does not
+*          start at firstKey, or as duplicates after a larger number; they
+*          are counted and dropped with a warning.
+*****/
+bool FrameEnumerator::next(std::string& path) {
+    std::unique_lock<std::mutex> lock(listMutex);
+    while (true) {
+        while (!pending.empty() && started && pending.front().key < lastKey) {
+            const Entry late = pending.front();
+            std::cerr << "Warning: dropping " \
+                      << names.substr(late.nameOffset, late.nameLength) \
+                      << ", frame " << late.key << " is a duplicate or out " \
+                      << "of order after frame " << lastKey << std::endl;
+            std::pop_heap(pending.begin(), pending.end(), Later());
+            pending.pop_back();
+            outOfOrderCount++;
+        }
+        if (!pending.empty()) {
+            const Entry top = pending.front();
+            const bool inOrder = top.key == expected || \
+                                 (started && top.key == lastKey);
+            if (inOrder || done) {
+                std::pop_heap(pending.begin(), pending.end(), Later());
+                pending.pop_back();
+                path = (FS::path(folder) / \
+                        names.substr(top.nameOffset, top.nameLength)).string();
+                lastKey = top.key;
+                expected = top.key + 1;
+                started = true;
+                return true;
+            }
+        } else if (done) {
+            return false;
+        }
+        listChanged.wait(lock);
+    }
+}
+
+size_t FrameEnumerator::accepted() const {
+    std::lock_guard<std::mutex> lock(listMutex);
+    return acceptedCount;
+}
+
+size_t FrameEnumerator::skipped() const {
+    std::lock_guard<std::mutex> lock(listMutex);
+    return skippedCount;
+}
+
+size_t FrameEnumerator::outOfOrder() const {
+    std::lock_guard<std::mutex> lock(listMutex);
+    return outOfOrderCount;
+}
+
+bool FrameEnumerator::finished() const {
+    std::lock_guard<std::mutex> lock(listMutex);
+    return done;
+}
+
+size_t FrameEnumerator::memoryBytes() const {
+    std::lock_guard<std::mutex> lock(listMutex);
+    return names.capacity() + pending.capacity() * sizeof(Entry);
+}
@@ -0,0 +1,251 @@
+/************************************************************************************************
+* @file      : Implementation for FrameRing class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The FrameRing class passes frames through POSIX shared memory
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "FrameRing.hpp"
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+
+namespace {
+// How long next() sleeps between two looks at an empty ring
+const std::chrono::microseconds kPollInterval(200);
+}  // namespace
+
+FrameRing::~FrameRing() {
+    finish();
+}
+
+bool FrameRing::create(const std::string& name, uint32_t slots, \
+                       uint32_t slotBytes) {
+    if (slots == 0 || slotBytes == 0) {
+        lastError = "a frame ring needs at least one slot of one byte";
+        return false;
+    }
+    // Slots start on a cache line so that the sequence numbers of two slots
+    // never share one
+    uint64_t stride = (sizeof(FrameSlot) + uint64_t(slotBytes) + 63) / 64 * 64;
+    if (!segment.create(name, sizeof(FrameRingHeader) + stride * slots)) {
+        lastError = segment.error();
+        return false;
+    }
+    header = new (segment.data()) FrameRingHeader();
+    std::memcpy(header->magic, kFrameRingMagic, sizeof(header->magic));
+    header->version = kRingVersion;
+    header->headerSize = sizeof(FrameRingHeader);
+    header->slotCount = slots;
+    header->slotBytes = slotBytes;
+    header->slotStride = stride;
+    header->published.store(0, std::memory_order_relaxed);
+    header->closed.store(0, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < slots; ++i) {
+        FrameSlot *slot = new (reinterpret_cast<unsigned char*>(header) + \
+                               sizeof(FrameRingHeader) + i * stride) FrameSlot();
+        slot->sequence.store(0, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    producer = true;
+    claimed = 0;
+    return true;
+}
+
+unsigned char *FrameRing::claim(int width, int height, int format) {
+    if (!producer || !header)
+        return nullptr;
+    uint64_t rowBytes = uint64_t(width) * pixelBytes(format);
+    int rows = planeRows(format, height);
+    if (width <= 0 || height <= 0 || rowBytes == 0 || rows == 0 || \
+        rowBytes * rows > header->slotBytes) {
+        lastError = "the frame does not fit into a ring slot";
+        return nullptr;
+    }
+    claimed = header->published.load(std::memory_order_relaxed) + 1;
+    FrameSlot *slot = slotAt(claimed);
+    // A reader which loads the busy marker or the new sequence after
+    // reading knows that the slot changed underneath it
+    slot->sequence.store(kSlotBusy, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot->width = width;
+    slot->height = height;
+    slot->stride = static_cast<int32_t>(rowBytes);
+    slot->format = format;
+    return reinterpret_cast<unsigned char*>(slot) + sizeof(FrameSlot);
+}
+
+void FrameRing::commit(uint64_t timestampNs) {
+    if (!producer || !header || claimed == 0)
+        return;
+    FrameSlot *slot = slotAt(claimed);
+    slot->timestampNs = timestampNs;
+    slot->sequence.store(claimed, std::memory_order_release);
+    header->published.store(claimed, std::memory_order_release);
+    claimed = 0;
+}
+
+bool FrameRing::publish(const FrameView& frame, uint64_t timestampNs) {
+    size_t rowBytes = size_t(frame.width) * pixelBytes(frame.format);
+    if (frame.data == nullptr)
+        return false;
+    unsigned char *pixels = claim(frame.width, frame.height, frame.format);
+    if (pixels == nullptr)
+        return false;
+    size_t stride = frame.stride != 0 ? frame.stride : rowBytes;
+    int rows = planeRows(frame.format, frame.height);
+    if (stride == rowBytes) {
+        std::memcpy(pixels, frame.data, rowBytes * rows);
+    } else {
+        for (int row = 0; row < rows; ++row)
+            std::memcpy(pixels + row * rowBytes, frame.data + row * stride, \
+                        rowBytes);
+    }
+    commit(timestampNs);
+    return true;
+}
+
+void FrameRing::finish() {
+    if (producer && header)
+        header->closed.store(1, std::memory_order_release);
+}
+
+bool FrameRing::attach(const std::string& name) {
+    producer = false;
+    header = nullptr;
+    if (!segment.attach(name)) {
+        lastError = segment.error();
+        return false;
+    }
+    FrameRingHeader *candidate = \
+        static_cast<FrameRingHeader*>(segment.data());
+    if (segment.size() < sizeof(FrameRingHeader) || \
+        std::memcmp(candidate->magic, kFrameRingMagic, \
+                    sizeof(candidate->magic)) != 0) {
+        lastError = name + " is not a frame ring";
+        return false;
+    }
+    if (candidate->version != kRingVersion || \
+        candidate->headerSize != sizeof(FrameRingHeader)) {
+        lastError = name + " has an unsupported frame ring version";
+        return false;
+    }
+    if (candidate->slotCount == 0 || \
+        candidate->slotStride < sizeof(FrameSlot) + candidate->slotBytes || \
+        segment.size() < sizeof(FrameRingHeader) + \
+                         candidate->slotStride * candidate->slotCount) {
+        lastError = name + " has a damaged frame ring header";
+        return false;
+    }
+    header = candidate;
+    uint64_t newest = header->published.load(std::memory_order_acquire);
+    nextSequence = newest >= header->slotCount ? \
+                   newest - header->slotCount + 1 : 1;
+    droppedFrames = 0;
+    tornFrames = 0;
+    return true;
+}
+
+bool FrameRing::next(FrameView& frame, FrameRing::FrameInfo& info, \
+                     double timeoutSeconds) {
+    waitTimedOut = false;
+    if (!header)
+        return false;
+    auto deadline = std::chrono::steady_clock::now() + \
+        std::chrono::microseconds(static_cast<int64_t>(timeoutSeconds * 1e6));
+    for (;;) {
+        // closed is read before published so that the frames published just
+        // before closing are never missed
+        bool closed = header->closed.load(std::memory_order_acquire) != 0;
+        uint64_t newest = header->published.load(std::memory_order_acquire);
+        if (nextSequence > newest) {
+            if (closed)
+                return false;
+            if (std::chrono::steady_clock::now() >= deadline) {
+                waitTimedOut = true;
+                return false;
+            }
+            std::this_thread::sleep_for(kPollInterval);
+            continue;
+        }
+        if (newest - nextSequence >= header->slotCount) {
+            uint64_t oldest = newest - header->slotCount + 1;
+            droppedFrames += oldest - nextSequence;
+            nextSequence = oldest;
+        }
+        uint64_t sequence = nextSequence++;
+        FrameSlot *slot = slotAt(sequence);
+        if (slot->sequence.load(std::memory_order_acquire) != sequence) {
+            ++droppedFrames;
+            continue;
+        }
+        int32_t width = slot->width;
+        int32_t height = slot->height;
+        int32_t stride = slot->stride;
+        int32_t format = slot->format;
+        uint64_t timestampNs = slot->timestampNs;
+        // Checked against the slot size so that a frame torn right now can
+        // still never point a reader past its slot
+        int bytes = pixelBytes(format);
+        int rows = planeRows(format, height);
+        bool valid = bytes != 0 && width > 0 && rows > 0 && \
+            stride >= int64_t(width) * bytes && \
+            int64_t(stride) * rows <= header->slotBytes;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (!valid || \
+            slot->sequence.load(std::memory_order_relaxed) != sequence) {
+            ++droppedFrames;
+            continue;
+        }
+        frame.data = reinterpret_cast<const unsigned char*>(slot) + \
+                     sizeof(FrameSlot);
+        frame.stride = static_cast<size_t>(stride);
+        frame.width = width;
+        frame.height = height;
+        frame.format = format;
+        info.sequence = sequence;
+        info.timestampNs = timestampNs;
+        return true;
+    }
+}
+
+bool FrameRing::intact(uint64_t sequence) {
+    if (!header)
+        return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slotAt(sequence)->sequence.load(std::memory_order_relaxed) == sequence)
+        return true;
+    ++tornFrames;
+    return false;
+}
+
+uint64_t FrameRing::published() const {
+    return header ? header->published.load(std::memory_order_acquire) : 0;
+}
+
+FrameSlot *FrameRing::slotAt(uint64_t sequence) const {
+    return reinterpret_cast<FrameSlot*>( \
+        reinterpret_cast<unsigned char*>(header) + sizeof(FrameRingHeader) + \
+        ((sequence - 1) % header->slotCount) * header->slotStride);
+}
@@ -0,0 +1,95 @@
+/************************************************************************************************
+* @file      : Implementation for FrameSource classes
+* @author    : Arun Kumar Devarajulu
+* @brief     : The VideoSource reads a video file through cv::VideoCapture
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "FrameSource.hpp"
+#include <iostream>
+#include "FrameView.hpp"
+
+long FrameSource::skip(long count) {
+    cv::Mat frame;
+    long skipped = 0;
+    while (skipped < count && read(frame))
+        skipped++;
+    return skipped;
+}
+
+VideoSource::VideoSource(const std::string& path, bool yuv) : \
+    videofile(path), rawFrames(yuv) {
+    if (rawFrames)
+        videofile.set(cv::CAP_PROP_CONVERT_RGB, 0);
+}
+
+/***
+*@brief  : The read() function takes a single channel frame with half again as
+*          many rows as the video as NV12, the layout of hardware decoders and
+*          of GStreamer pipelines ending in video/x-raw,format=NV12. Backends
+*          which do not deliver NV12, such as FFmpeg which hands out only the
+*          luminance of yuv420p, get the BGR conversion back, and the frame is
+*          retrieved again in BGR, so that no frame is taken as gray.
+*****/
+bool VideoSource::read(cv::Mat& frame) {
+    videofile >> frame;  //  <Grab the image frame
+    frameFormat = -1;
+    if (!rawFrames || frame.empty() || frame.channels() == 3)
+        return !frame.empty();
+    if (frame.type() == CV_8UC1 && \
+        frame.rows == planeRows(PIXEL_NV12, frameSize().height)) {
+        frameFormat = PIXEL_NV12;
+        return true;
+    }
+    std::cerr << "Warning: the video backend does not deliver NV12 frames, " \
+                 "reading BGR frames instead" << std::endl;
+    rawFrames = false;
+    videofile.set(cv::CAP_PROP_CONVERT_RGB, 1);
+    if (!videofile.retrieve(frame) || frame.channels() != 3) {
+        std::cerr << "Error: the video backend delivers neither NV12 nor " \
+                     "BGR frames" << std::endl;
+        frame.release();
+        return false;
+    }
+    return true;
+}
+
+/***
+*@brief  : The skip() function grabs the frames without retrieving them. A seek
+*          with CAP_PROP_POS_FRAMES would be faster, but lands on a key frame
+*          with some codecs, and a resumed job has to see the same frames.
+*****/
+long VideoSource::skip(long count) {
+    long skipped = 0;
+    while (skipped < count && videofile.grab())
+        skipped++;
+    return skipped;
+}
+
+cv::Size VideoSource::frameSize() const {
+    return cv::Size(static_cast<int>(videofile.get(CV_CAP_PROP_FRAME_WIDTH)), \
+                    static_cast<int>(videofile.get(CV_CAP_PROP_FRAME_HEIGHT)));
+}
+
+double VideoSource::fps() const {
+    return videofile.get(CV_CAP_PROP_FPS);
+}
@@ -0,0 +1,181 @@
+/************************************************************************************************
+* @file      : Implementation for ImageSequenceSource class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ImageSequenceSource class decodes a sequence of image files on a pool
+*              of worker threads and hands them to the detector in order
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "ImageSequenceSource.hpp"
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace {
+/***
+*@brief  : Hands out the entries of a list of image files one at a time
+*****/
+struct ListFeed {
+    explicit ListFeed(const std::vector<std::string>& list) : paths(list) {}
+    bool operator()(std::string& path) {
+        if (index >= paths.size())
+            return false;
+        path = paths[index++];
+        return true;
+    }
+    std::vector<std::string> paths;
+    size_t index = 0;
+};
+}  // namespace
+
+/***
+*@brief  : The constructor decodes the first frame on the calling thread to learn
+*          the frame size, puts it in the reorder buffer and starts the pool
+*@params : feed hands out the image files in frame order
+*@params : workers is the number of decoding threads
+*@params : rate is the frame rate reported for the sequence
+*@params : window is the number of frames decoded ahead of the detector
+*****/
+ImageSequenceSource::ImageSequenceSource(PathFeed feed, int workers, \
+                                         double rate, size_t window) : \
+    nextPath(feed), frameRate(rate), \
+    total(std::numeric_limits<size_t>::max()) {
+    std::string path;
+    if (!nextPath(path))
+        return;
+    cv::Mat first = cv::imread(path, cv::IMREAD_COLOR);
+    if (first.empty()) {
+        std::cout << "Error decoding " << path << std::endl;
+        return;
+    }
+    firstSize = first.size();
+
+    workers = std::max(1, workers);
+    size_t capacity = window > 0 ? window : 2 * static_cast<size_t>(workers);
+    slots.resize(std::max<size_t>(capacity, 2));
+    ready.assign(slots.size(), 0);
+    slots[0] = first;
+    ready[0] = 1;
+    nextDecode = 1;
+
+    for (int i = 0; i < workers; i++) {
+        pool.emplace_back(&ImageSequenceSource::decode, this);
+    }
+}
+
+ImageSequenceSource::ImageSequenceSource(const std::vector<std::string>& \
+                                         paths, int workers, double rate, \
+                                         size_t window) : \
+    ImageSequenceSource(ListFeed(paths), workers, rate, window) {}
+
+/***
+*@brief  : The decode() function claims the next image file from the feed,
+*          waits until its slot is within the window ahead of the detector,
+*          decodes the image without holding a lock and publishes it. The
+*          workers finish frames out of order, the slot index puts them back
+*          in order. The feed is called under its own lock so that the
+*          detector is not held up while the files are still being listed.
+*****/
+void ImageSequenceSource::decode() {
+    while (true) {
+        size_t index;
+        std::string path;
+        {
+            std::lock_guard<std::mutex> claim(claimMutex);
+            if (exhausted)
+                return;
+            if (!nextPath(path)) {
+                exhausted = true;
+                {
+                    std::lock_guard<std::mutex> lock(bufferMutex);
+                    total = nextDecode;
+                }
+                slotReady.notify_all();
+                return;
+            }
+            index = nextDecode++;
+        }
+        {
+            std::unique_lock<std::mutex> lock(bufferMutex);
+            slotFree.wait(lock, [this, index] {
+                return stopping || index < nextRead + slots.size();
+            });
+            if (stopping)
+                return;
+        }
+
+        cv::Mat image = cv::imread(path, cv::IMREAD_COLOR);
+        if (image.empty())
+            std::cout << "Error decoding " << path << std::endl;
+
+        {
+            std::lock_guard<std::mutex> lock(bufferMutex);
+            slots[index % slots.size()] = image;
+            ready[index % slots.size()] = 1;
+        }
+        slotReady.notify_all();
+    }
+}
+
+/***
+*@brief  : The read() function waits for the next frame in order and frees its
+*          slot. Images which fail to decode are skipped.
+*@params : frame is the container for the next frame
+*@return : false once all the images have been read
+*****/
+bool ImageSequenceSource::read(cv::Mat& frame) {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(bufferMutex);
+            if (slots.empty())
+                return false;
+            size_t slot = nextRead % slots.size();
+            slotReady.wait(lock, [this, slot] {
+                return ready[slot] != 0 || nextRead >= total || stopping;
+            });
+            if (ready[slot] == 0)
+                return false;
+            frame = slots[slot];
+            slots[slot].release();
+            ready[slot] = 0;
+            nextRead++;
+        }
+        slotFree.notify_all();
+        if (!frame.empty())
+            return true;
+    }
+}
+
+void ImageSequenceSource::release() {
+    {
+        std::lock_guard<std::mutex> lock(bufferMutex);
+        stopping = true;
+    }
+    slotFree.notify_all();
+    for (auto& worker : pool) {
+        if (worker.joinable())
+            worker.join();
+    }
+    pool.clear();
+}
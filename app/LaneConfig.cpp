@@ -0,0 +1,316 @@
+/************************************************************************************************
+* @file      : Implementation for LaneConfig class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneConfig structure reads per-camera settings from cv::FileStorage nodes
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "LaneConfig.hpp"
+#include <string>
+#include <vector>
+#include "LaneRecord.hpp"
+
+namespace {
+/***
+*@brief  : Reads a sequence of numbers, a missing node leaves values alone
+*@return : false if the node is neither missing nor a sequence of numbers
+*****/
+bool readNumbers(const cv::FileNode& node, std::vector<double>& values) {
+    if (node.empty() || node.isNone())
+        return true;
+    if (!node.isSeq())
+        return false;
+    values.clear();
+    for (cv::FileNodeIterator it = node.begin(); it != node.end(); ++it) {
+        values.push_back(static_cast<double>(*it));
+    }
+    return true;
+}
+
+bool readScalar(const cv::FileNode& node, cv::Scalar& value) {
+    std::vector<double> values;
+    if (!readNumbers(node, values) || (!values.empty() && values.size() != 3))
+        return false;
+    if (!values.empty())
+        value = cv::Scalar(values[0], values[1], values[2]);
+    return true;
+}
+
+/***
+*@brief  : Reads a pair of increasing positive thresholds
+*****/
+bool readPair(const cv::FileNode& node, double& low, double& high) {
+    std::vector<double> values;
+    if (!readNumbers(node, values) || (!values.empty() && \
+        (values.size() != 2 || values[0] <= 0 || values[1] < values[0])))
+        return false;
+    if (!values.empty()) {
+        low = values[0];
+        high = values[1];
+    }
+    return true;
+}
+
+void readString(const cv::FileNode& node, std::string& value) {
+    if (!node.empty() && node.isString())
+        value = static_cast<std::string>(node);
+}
+}  // namespace
+
+LaneConfig::LaneConfig() : calibrationSize(1280, 720), \
+    whiteMin(198, 0, 0), whiteMax(255, 255, 255), \
+    yellowMin(165, 130, 130), yellowMax(255, 255, 255), processScale(1.0), \
+    gaussKernel(5), cannyLow(15), cannyHigh(45), polygonCannyLow(70), \
+    polygonCannyHigh(210), houghRho(1), houghTheta(CV_PI / 180), \
+    houghThreshold(10), bandRows(0), engine(ENGINE_HOUGH), \
+    viewSize(320, 360) {
+    //  Camera parameters and distortion coefficients of the 1280x720 camera
+    camParams = (cv::Mat_<double>(3, 3) << 1.15422732e+03, \
+                 0.00000000e+00, 6.71627794e+02, 0.00000000e+00, \
+                 1.14818221e+03, 3.86046312e+02, 0.00000000e+00, \
+                 0.00000000e+00, 1.00000000e+00);
+    distCoeffs = (cv::Mat_<double>(1, 8) << -2.42565104e-01, \
+                  -4.77893070e-02, -1.31388084e-03, \
+                  -8.79107779e-05, 2.20573263e-02, 0, 0, 0);
+}
+
+bool LaneConfig::read(const cv::FileNode& node, std::string& error) {
+    if (!node.isMap()) {
+        error = "configuration is not a map";
+        return false;
+    }
+    readString(node["name"], name);
+    readString(node["input"], input);
+    readString(node["output"], output);
+    readString(node["results"], results);
+    readString(node["binary"], binary);
+
+    if (!node["camera_matrix"].empty()) {
+        cv::Mat matrix;
+        node["camera_matrix"] >> matrix;
+        if (matrix.rows != 3 || matrix.cols != 3) {
+            error = "camera_matrix is not 3x3";
+            return false;
+        }
+        // Converted into a new matrix, since a copied configuration shares
+        // the buffer of camParams with the one it was copied from
+        cv::Mat converted;
+        matrix.convertTo(converted, CV_64F);
+        camParams = converted;
+    }
+    if (!node["distortion"].empty()) {
+        cv::Mat coeffs;
+        node["distortion"] >> coeffs;
+        if (coeffs.total() < 4) {
+            error = "distortion needs at least 4 coefficients";
+            return false;
+        }
+        cv::Mat converted;
+        coeffs.reshape(1, 1).convertTo(converted, CV_64F);
+        distCoeffs = converted;
+    }
+
+    std::vector<double> values;
+    if (!readNumbers(node["calibration_size"], values) || \
+        (!values.empty() && values.size() != 2)) {
+        error = "calibration_size is not [width, height]";
+        return false;
+    }
+    if (!values.empty())
+        calibrationSize = cv::Size(cvRound(values[0]), cvRound(values[1]));
+
+    if (!readScalar(node["white_min"], whiteMin) || \
+        !readScalar(node["white_max"], whiteMax) || \
+        !readScalar(node["yellow_min"], yellowMin) || \
+        !readScalar(node["yellow_max"], yellowMax)) {
+        error = "thresholds need three L*a*b values";
+        return false;
+    }
+
+    values.clear();
+    if (!readNumbers(node["roi"], values) || values.size() % 2 != 0 || \
+        (!values.empty() && values.size() < 6)) {
+        error = "roi needs at least three normalized x, y pairs";
+        return false;
+    }
+    if (!values.empty()) {
+        roi.clear();
+        for (size_t i = 0; i < values.size(); i += 2)
+            roi.push_back(cv::Point2d(values[i], values[i + 1]));
+    }
+
+    if (!node["process_scale"].empty()) {
+        processScale = static_cast<double>(node["process_scale"]);
+        if (processScale <= 0 || processScale > 1) {
+            error = "process_scale must be in (0, 1]";
+            return false;
+        }
+    }
+
+    // The settings of the detection chain, as tuned by lane-tune
+    if (!node["gauss_kernel"].empty()) {
+        gaussKernel = static_cast<int>(node["gauss_kernel"]);
+        if (gaussKernel >= 3 && gaussKernel % 2 == 0) {
+            error = "gauss_kernel must be odd";
+            return false;
+        }
+    }
+    if (!readPair(node["canny"], cannyLow, cannyHigh) || \
+        !readPair(node["polygon_canny"], polygonCannyLow, polygonCannyHigh)) {
+        error = "canny thresholds need a low and a higher value";
+        return false;
+    }
+    if (!node["hough_rho"].empty())
+        houghRho = static_cast<double>(node["hough_rho"]);
+    if (!node["hough_theta"].empty())
+        houghTheta = static_cast<double>(node["hough_theta"]) * CV_PI / 180;
+    if (!node["hough_threshold"].empty())
+        houghThreshold = static_cast<int>(node["hough_threshold"]);
+    if (houghRho <= 0 || houghTheta <= 0 || houghThreshold < 1) {
+        error = "hough_rho, hough_theta and hough_threshold must be positive";
+        return false;
+    }
+    if (!node["band_rows"].empty())
+        bandRows = static_cast<int>(node["band_rows"]);
+
+    std::string engineName;
+    readString(node["engine"], engineName);
+    if (!engineName.empty() && !engineFromName(engineName, engine)) {
+        error = "engine must be hough or window";
+        return false;
+    }
+    values.clear();
+    if (!readNumbers(node["birds_eye"], values) || \
+        (!values.empty() && values.size() != 8)) {
+        error = "birds_eye needs four normalized x, y pairs";
+        return false;
+    }
+    if (!values.empty()) {
+        birdsEye.clear();
+        for (size_t i = 0; i < values.size(); i += 2)
+            birdsEye.push_back(cv::Point2d(values[i], values[i + 1]));
+    }
+    values.clear();
+    if (!readNumbers(node["view_size"], values) || (!values.empty() && \
+        (values.size() != 2 || values[0] < 16 || values[1] < 16))) {
+        error = "view_size is not [width, height] of at least 16 pixels";
+        return false;
+    }
+    if (!values.empty())
+        viewSize = cv::Size(cvRound(values[0]), cvRound(values[1]));
+    if (engine == ENGINE_WINDOW && birdsEye.empty() && !roi.empty() && \
+        roi.size() != 4) {
+        error = "the window engine needs birds_eye or a four corner roi";
+        return false;
+    }
+    return true;
+}
+
+/***
+*@brief  : The settingsHash() function lays the settings out as doubles, which
+*          hold every integer and double setting exactly, and hashes them
+*****/
+uint64_t LaneConfig::settingsHash() const {
+    std::vector<double> values;
+    cv::Mat cam, dist;
+    camParams.convertTo(cam, CV_64F);
+    distCoeffs.convertTo(dist, CV_64F);
+    for (const cv::Mat* matrix : {&cam, &dist}) {
+        const double* first = matrix->ptr<double>();
+        values.insert(values.end(), first, first + matrix->total());
+    }
+    values.push_back(calibrationSize.width);
+    values.push_back(calibrationSize.height);
+    for (const cv::Scalar* bound : {&whiteMin, &whiteMax, &yellowMin, \
+                                    &yellowMax}) {
+        values.insert(values.end(), bound->val, bound->val + 3);
+    }
+    values.push_back(roi.size());
+    for (auto& corner : roi) {
+        values.push_back(corner.x);
+        values.push_back(corner.y);
+    }
+    values.insert(values.end(), {processScale, \
+                                 static_cast<double>(gaussKernel), \
+                                 cannyLow, cannyHigh, polygonCannyLow, \
+                                 polygonCannyHigh, houghRho, houghTheta, \
+                                 static_cast<double>(houghThreshold), \
+                                 static_cast<double>(engine)});
+    values.push_back(birdsEye.size());
+    for (auto& corner : birdsEye) {
+        values.push_back(corner.x);
+        values.push_back(corner.y);
+    }
+    values.push_back(viewSize.width);
+    values.push_back(viewSize.height);
+    return laneHash(values.data(), values.size() * sizeof(double));
+}
+
+bool LaneConfig::engineFromName(const std::string& text, int& value) {
+    if (text == "hough") {
+        value = ENGINE_HOUGH;
+    } else if (text == "window") {
+        value = ENGINE_WINDOW;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool LaneConfig::loadFile(const std::string& path, std::string& error) {
+    cv::FileStorage file(path, cv::FileStorage::READ);
+    if (!file.isOpened()) {
+        error = "cannot open " + path;
+        return false;
+    }
+    return read(file.root(), error);
+}
+
+std::vector<LaneConfig> LaneConfig::loadStreams(const std::string& path, \
+                                                std::string& error, \
+                                                const LaneConfig& base) {
+    std::vector<LaneConfig> streams;
+    cv::FileStorage file(path, cv::FileStorage::READ);
+    if (!file.isOpened()) {
+        error = "cannot open " + path;
+        return streams;
+    }
+    cv::FileNode list = file["streams"];
+    if (!list.isSeq() || list.size() == 0) {
+        error = path + " has no streams sequence";
+        return streams;
+    }
+    for (cv::FileNodeIterator it = list.begin(); it != list.end(); ++it) {
+        LaneConfig config = base;
+        config.name = "stream" + std::to_string(streams.size());
+        if (!config.read(*it, error)) {
+            error = config.name + ": " + error;
+            return std::vector<LaneConfig>();
+        }
+        if (config.input.empty()) {
+            error = config.name + ": input is missing";
+            return std::vector<LaneConfig>();
+        }
+        streams.push_back(config);
+    }
+    return streams;
+}
@@ -0,0 +1,215 @@
+/************************************************************************************************
+* @file      : Implementation of the sliding window lane fitter
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneFitter class finds the two lanes of a top-down binary lane mask. The lane
+*              bases come from a column histogram of the lower rows, sliding windows follow each lane
+*              upwards, and a second order polynomial is fitted to the lane pixels by least squares.
+*              Once both lanes are tracked only the pixels near the previous fits are searched.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "LaneFitter.hpp"
+#include "PixelStages.hpp"
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+namespace {
+/***
+*@brief  : Orders the pixels of cv::findNonZero, which come row by row, by row
+*****/
+bool rowBefore(const cv::Point& pixel, int row) {
+    return pixel.y < row;
+}
+}  // namespace
+
+/***
+*@brief  : The fit() function collects the lane pixels once with
+*          cv::findNonZero, so everything after it scales with the number of
+*          lane pixels and not with the view size or a line accumulator
+*@params : mask is the CV_8U top-down lane mask
+*@return : true if both lanes were fitted
+*****/
+bool LaneFitter::fit(const cv::Mat& mask) {
+    CV_Assert(mask.type() == CV_8UC1 && !mask.empty());
+    std::vector<cv::Point> pixels;
+    cv::findNonZero(mask, pixels);
+    int margin = std::max(1, cvRound(options.margin * mask.cols));
+    std::vector<cv::Point> leftPixels, rightPixels;
+    if (tracked) {
+        usedWindows = false;
+        searchAround(pixels, margin, leftPixels, rightPixels);
+        if (accept(leftPixels, rightPixels, mask.rows))
+            return true;
+        leftPixels.clear();
+        rightPixels.clear();
+    }
+    usedWindows = true;
+    slidingWindows(mask, pixels, leftPixels, rightPixels);
+    tracked = accept(leftPixels, rightPixels, mask.rows);
+    return tracked;
+}
+
+/***
+*@brief  : The slidingWindows() function starts each lane at the peak of the
+*          column histogram in its half of the view. A window takes the pixels
+*          within the margin of its center, and moves the center of the next
+*          window to their mean column when there are enough of them, so the
+*          windows follow a curving lane.
+*****/
+void LaneFitter::slidingWindows(const cv::Mat& mask, \
+                                const std::vector<cv::Point>& pixels, \
+                                std::vector<cv::Point>& leftPixels, \
+                                std::vector<cv::Point>& rightPixels) const {
+    int histogramTop = mask.rows - std::max(1, \
+                       cvRound(options.histogramRows * mask.rows));
+    cv::Mat histogram;
+    cv::reduce(mask.rowRange(std::max(0, histogramTop), mask.rows), \
+               histogram, 0, cv::REDUCE_SUM, CV_32S);
+    int half = mask.cols / 2;
+    double leftPeak = 0, rightPeak = 0;
+    cv::Point leftBase, rightBase;
+    cv::minMaxLoc(histogram.colRange(0, half), 0, &leftPeak, 0, &leftBase);
+    cv::minMaxLoc(histogram.colRange(half, mask.cols), 0, &rightPeak, 0, \
+                  &rightBase);
+
+    int centers[2] = {leftBase.x, half + rightBase.x};
+    bool found[2] = {leftPeak > 0, rightPeak > 0};
+    std::vector<cv::Point>* lanes[2] = {&leftPixels, &rightPixels};
+    int margin = std::max(1, cvRound(options.margin * mask.cols));
+    int windows = std::max(1, options.windows);
+    int windowRows = std::max(1, (mask.rows + windows - 1) / windows);
+    for (int bottom = mask.rows; bottom > 0; bottom -= windowRows) {
+        int top = std::max(0, bottom - windowRows);
+        // The rows of a window are one range of the row ordered pixels
+        auto first = std::lower_bound(pixels.begin(), pixels.end(), top, \
+                                      rowBefore);
+        auto last = std::lower_bound(first, pixels.end(), bottom, rowBefore);
+        for (int lane = 0; lane < 2; ++lane) {
+            if (!found[lane])
+                continue;
+            long columns = 0;
+            int count = 0;
+            for (auto pixel = first; pixel != last; ++pixel) {
+                if (std::abs(pixel->x - centers[lane]) < margin) {
+                    lanes[lane]->push_back(*pixel);
+                    columns += pixel->x;
+                    count++;
+                }
+            }
+            if (count >= options.recenterPixels)
+                centers[lane] = static_cast<int>(columns / count);
+        }
+    }
+}
+
+LANE_CLONES
+void LaneFitter::searchAround(const std::vector<cv::Point>& pixels, \
+                              int margin, \
+                              std::vector<cv::Point>& leftPixels, \
+                              std::vector<cv::Point>& rightPixels) const {
+    for (auto& pixel : pixels) {
+        if (std::abs(pixel.x - evaluate(leftFit, pixel.y)) < margin) {
+            leftPixels.push_back(pixel);
+        } else if (std::abs(pixel.x - evaluate(rightFit, pixel.y)) < margin) {
+            rightPixels.push_back(pixel);
+        }
+    }
+}
+
+bool LaneFitter::accept(const std::vector<cv::Point>& leftPixels, \
+                        const std::vector<cv::Point>& rightPixels, \
+                        int rows) {
+    cv::Vec3d newLeft, newRight;
+    if (static_cast<int>(leftPixels.size()) < options.fitPixels || \
+        static_cast<int>(rightPixels.size()) < options.fitPixels || \
+        !fitPolynomial(leftPixels, newLeft) || \
+        !fitPolynomial(rightPixels, newRight))
+        return false;
+    for (int row : {0, rows / 2, rows - 1}) {
+        if (evaluate(newLeft, row) >= evaluate(newRight, row))
+            return false;
+    }
+    leftFit = newLeft;
+    rightFit = newRight;
+    pixelCount = leftPixels.size() + rightPixels.size();
+    return true;
+}
+
+/***
+*@brief  : The fitPolynomial() function solves the normal equations of the
+*          least squares fit. The rows are centered and scaled to [-1, 1]
+*          first, which keeps the 3x3 system well conditioned, and the
+*          coefficients are transformed back to rows afterwards.
+*@params : pixels are the lane pixels
+*@params : coeffs receives a, b and c of x = a * y^2 + b * y + c
+*@return : false if the pixels lie on fewer than three rows
+*****/
+LANE_CLONES
+bool LaneFitter::fitPolynomial(const std::vector<cv::Point>& pixels, \
+                               cv::Vec3d& coeffs) {
+    if (pixels.empty())
+        return false;
+    int rows[2] = {pixels.front().y, pixels.front().y};
+    int minRow = pixels.front().y, maxRow = pixels.front().y;
+    bool distinct = false;
+    for (auto& pixel : pixels) {
+        if (pixel.y != rows[0] && rows[1] == rows[0]) {
+            rows[1] = pixel.y;
+        } else if (pixel.y != rows[0] && pixel.y != rows[1]) {
+            distinct = true;
+        }
+        minRow = std::min(minRow, pixel.y);
+        maxRow = std::max(maxRow, pixel.y);
+    }
+    if (!distinct)
+        return false;
+
+    double center = 0.5 * (minRow + maxRow);
+    double scale = 0.5 * (maxRow - minRow);
+    double sums[5] = {0, 0, 0, 0, 0};
+    double xSums[3] = {0, 0, 0};
+    for (auto& pixel : pixels) {
+        double t = (pixel.y - center) / scale;
+        double power = 1;
+        for (int k = 0; k < 5; ++k) {
+            sums[k] += power;
+            if (k < 3)
+                xSums[k] += pixel.x * power;
+            power *= t;
+        }
+    }
+    cv::Mat normal = (cv::Mat_<double>(3, 3) << sums[4], sums[3], sums[2], \
+                      sums[3], sums[2], sums[1], sums[2], sums[1], sums[0]);
+    cv::Mat moments = (cv::Mat_<double>(3, 1) << xSums[2], xSums[1], \
+                       xSums[0]);
+    cv::Mat solution;
+    if (!cv::solve(normal, moments, solution, cv::DECOMP_CHOLESKY))
+        return false;
+    // x = A t^2 + B t + C with t = (y - center) / scale
+    double a = solution.at<double>(0) / (scale * scale);
+    double b = solution.at<double>(1) / scale;
+    coeffs = cv::Vec3d(a, b - 2 * a * center, \
+                       (a * center - b) * center + solution.at<double>(2));
+    return true;
+}
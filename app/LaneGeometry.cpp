@@ -0,0 +1,150 @@
+/************************************************************************************************
+* @file      : Implementation for LaneGeometry class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneGeometry class keeps every frame dependent constant of the lane
+*              detection pipeline in normalized frame co-ordinates and handles the
+*              processing scale
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "LaneGeometry.hpp"
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+/***
+*@brief  : The constructor stores all the constants as fractions of the 1280x720
+*          reference frame, written as ratios so that they round back to the
+*          original pixel values on 720p input
+*@params : procScale is the processing scale in the range (0, 1]
+*****/
+LaneGeometry::LaneGeometry(double procScale) : \
+    scale(std::min(1.0, std::max(procScale, 1.0 / 64))), reference(1280, 720), \
+    topRow(650.0 / 720), bottomRow(704.0 / 720), horizon(550.0 / 720), \
+    extent(1500.0 / 1280), tolerance(10.0 / 1280) {
+    roiCorners.push_back(cv::Point2d(527.0 / 1280, 491.0 / 720));
+    roiCorners.push_back(cv::Point2d(812.0 / 1280, 491.0 / 720));
+    roiCorners.push_back(cv::Point2d(1163.0 / 1280, 704.0 / 720));
+    roiCorners.push_back(cv::Point2d(281.0 / 1280, 704.0 / 720));
+}
+
+LaneGeometry::LaneGeometry(double procScale, const std::vector<cv::Point2d>& \
+                           roi, cv::Size calibration) : \
+    LaneGeometry(procScale) {
+    if (!roi.empty())
+        roiCorners = roi;
+    if (calibration.area() > 0)
+        reference = cv::Size2d(calibration.width, calibration.height);
+}
+
+/***
+*@brief  : The downscale() function halves the frame with cv::pyrDown as long as
+*          the remaining scale is at most one half, and resizes by whatever is
+*          left with area interpolation. Power of two scales therefore only use
+*          the pyramid, which is both fast and properly low-pass filtered.
+*@params : rawImg is the full resolution input image frame
+*@return : The image frame on which the detection runs
+*****/
+cv::Mat LaneGeometry::downscale(cv::Mat rawImg) const {
+    cv::Mat smallImg = rawImg;
+    double remaining = scale;
+    while (remaining <= 0.5 + 1e-9) {
+        cv::Mat halfImg;
+        cv::pyrDown(smallImg, halfImg);
+        smallImg = halfImg;
+        remaining *= 2;
+    }
+    if (remaining < 1.0 - 1e-9) {
+        cv::Mat resizedImg;
+        cv::resize(smallImg, resizedImg, cv::Size(), remaining, remaining, \
+                   cv::INTER_AREA);
+        smallImg = resizedImg;
+    }
+    return smallImg;
+}
+
+std::vector<cv::Point> LaneGeometry::toFrame(const std::vector<cv::Point>& \
+                                             points, cv::Size from, \
+                                             cv::Size to) const {
+    double sx = static_cast<double>(to.width) / from.width;
+    double sy = static_cast<double>(to.height) / from.height;
+    std::vector<cv::Point> framePoints;
+    for (auto& point : points) {
+        framePoints.push_back(cv::Point(cvRound(point.x * sx), \
+                                        cvRound(point.y * sy)));
+    }
+    return framePoints;
+}
+
+cv::Point2d LaneGeometry::toFrame(cv::Point2d point, cv::Size from, \
+                                  cv::Size to) const {
+    return cv::Point2d(point.x * to.width / from.width, \
+                       point.y * to.height / from.height);
+}
+
+std::vector<cv::Point> LaneGeometry::roiPolygon(cv::Size frame) const {
+    std::vector<cv::Point> corners;
+    for (auto& corner : roiCorners) {
+        corners.push_back(cv::Point(cvRound(corner.x * frame.width), \
+                                    cvRound(corner.y * frame.height)));
+    }
+    return corners;
+}
+
+/***
+*@brief  : The cameraMatrix() function scales the focal lengths and the principal
+*          point with the image size. The distortion coefficients work on
+*          normalized image co-ordinates and therefore need no scaling.
+*@params : camParams is the 3x3 camera matrix for the reference resolution
+*@params : frame is the size of the image the camera matrix is used on
+*@return : The camera matrix for the given image size
+*****/
+cv::Mat LaneGeometry::cameraMatrix(cv::Mat camParams, cv::Size frame) const {
+    cv::Mat scaled = camParams.clone();
+    double sx = frame.width / reference.width;
+    double sy = frame.height / reference.height;
+    scaled.at<double>(0, 0) *= sx;
+    scaled.at<double>(0, 2) *= sx;
+    scaled.at<double>(1, 1) *= sy;
+    scaled.at<double>(1, 2) *= sy;
+    return scaled;
+}
+
+int LaneGeometry::polygonTopRow(cv::Size frame) const {
+    return cvRound(topRow * frame.height);
+}
+
+int LaneGeometry::polygonBottomRow(cv::Size frame) const {
+    return cvRound(bottomRow * frame.height);
+}
+
+int LaneGeometry::horizonRow(cv::Size frame) const {
+    return cvRound(horizon * frame.height);
+}
+
+double LaneGeometry::lineExtent(cv::Size frame) const {
+    return extent * frame.width;
+}
+
+int LaneGeometry::jumpTolerance(cv::Size frame) const {
+    return std::max(1, cvRound(tolerance * frame.width));
+}
@@ -0,0 +1,194 @@
+/************************************************************************************************
+* @file      : Implementation for LanePipeline class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LanePipeline class finds the lanes of caller-owned frames with the gate,
+*              the rate controller and the detection chain
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "LanePipeline.hpp"
+#include "LaneRecord.hpp"
+
+LanePipeline::LanePipeline(const Options& options) : settings(options), \
+    lanes(options.config), \
+    rateControl(options.targetFps, *options.rateLog) {}
+
+void LanePipeline::restart() {
+    lanes.restart();
+    changeGate.reset();
+    lastDetected = false;
+}
+
+LanePipeline::State LanePipeline::state() const {
+    State saved;
+    saved.lanes = lanes.state();
+    saved.gated = static_cast<bool>(changeGate);
+    if (changeGate) {
+        saved.frameSize = gateSize;
+        saved.gate = changeGate->state();
+    }
+    return saved;
+}
+
+void LanePipeline::restore(const State& saved) {
+    restart();
+    lanes.restore(saved.lanes);
+    if (settings.gate && saved.gated) {
+        changeGate.reset(new ChangeDetector( \
+                lanes.geometry().roiPolygon(saved.frameSize), \
+                settings.gateThreshold, settings.gateMaxReuse));
+        gateSize = saved.frameSize;
+        changeGate->restore(saved.gate);
+    }
+}
+
+/***
+*@brief  : The settingsHash() function adds the gate settings to the hash of
+*          the camera configuration, the rate controller only runs on live
+*          input and is left out
+*****/
+uint64_t LanePipeline::settingsHash() const {
+    double gateSettings[3] = {0, 0, 0};
+    if (settings.gate) {
+        gateSettings[0] = 1;
+        gateSettings[1] = settings.gateThreshold;
+        gateSettings[2] = settings.gateMaxReuse;
+    }
+    return laneHash(gateSettings, sizeof(gateSettings), \
+                    settings.config.settingsHash());
+}
+
+cv::Mat LanePipeline::wrap(const FrameView& frame) {
+    int channels = pixelBytes(frame.format);
+    int rows = planeRows(frame.format, frame.height);
+    size_t rowBytes = static_cast<size_t>(frame.width) * channels;
+    if (channels == 0 || frame.data == nullptr || \
+        frame.width <= 0 || rows <= 0 || \
+        (frame.format == PIXEL_NV12 && frame.width % 2 != 0) || \
+        (frame.stride != 0 && frame.stride < rowBytes))
+        return cv::Mat();
+    // The pipeline never writes to the frame, the const_cast only satisfies
+    // the cv::Mat constructor
+    return cv::Mat(rows, frame.width, CV_8UC(channels), \
+                   const_cast<unsigned char*>(frame.data), \
+                   frame.stride != 0 ? frame.stride : rowBytes);
+}
+
+FrameView LanePipeline::view(const cv::Mat& image, int format) {
+    FrameView frame;
+    if (image.depth() != CV_8U)
+        return frame;
+    if (format == PIXEL_NV12) {
+        if (image.channels() != 1 || image.rows % 3 != 0)
+            return frame;
+        frame.format = PIXEL_NV12;
+    } else if (format >= 0 && pixelBytes(format) == image.channels()) {
+        frame.format = format;
+    } else {
+        switch (image.channels()) {
+            case 1: frame.format = PIXEL_GRAY; break;
+            case 3: frame.format = PIXEL_BGR; break;
+            case 4: frame.format = PIXEL_BGRA; break;
+            default: return frame;
+        }
+    }
+    frame.data = image.data;
+    frame.stride = image.step;
+    frame.width = image.cols;
+    frame.height = frame.format == PIXEL_NV12 ? image.rows / 3 * 2 : \
+                                                image.rows;
+    return frame;
+}
+
+/***
+*@brief  : The nv12() function goes through the planar I420 layout of
+*          cv::cvtColor, whose U and V planes only have to be interleaved
+*****/
+cv::Mat LanePipeline::nv12(const cv::Mat& bgr) {
+    CV_Assert(bgr.type() == CV_8UC3 && bgr.cols % 2 == 0 && \
+              bgr.rows % 2 == 0);
+    cv::Mat i420, frame(bgr.rows / 2 * 3, bgr.cols, CV_8UC1);
+    cv::cvtColor(bgr, i420, cv::COLOR_BGR2YUV_I420);
+    i420.rowRange(0, bgr.rows).copyTo(frame.rowRange(0, bgr.rows));
+    cv::Size chroma(bgr.cols / 2, bgr.rows / 2);
+    const uchar* planes = i420.ptr(bgr.rows);
+    std::vector<cv::Mat> uv = { \
+        cv::Mat(chroma, CV_8UC1, const_cast<uchar*>(planes)), \
+        cv::Mat(chroma, CV_8UC1, const_cast<uchar*>(planes) + chroma.area())};
+    cv::Mat interleaved(chroma, CV_8UC2, frame.ptr(bgr.rows));
+    cv::merge(uv, interleaved);
+    return frame;
+}
+
+cv::Mat LanePipeline::bgr(const cv::Mat& image, int format) {
+    if (format != PIXEL_NV12)
+        return image;
+    cv::Mat converted;
+    cv::cvtColor(image, converted, cv::COLOR_YUV2BGR_NV12);
+    return converted;
+}
+
+/***
+*@brief  : The process() function reuses the last lanes when the gate finds the
+*          frame unchanged, extrapolates them when the rate controller skips
+*          the frame and runs the detection chain otherwise. The time spent
+*          here drives the rate controller.
+*****/
+LaneResult LanePipeline::process(const FrameView& view) {
+    cv::Mat planes = wrap(view);
+    lastDetected = false;
+    if (planes.empty())
+        return LaneResult();
+    // The gate and the lane history only look at the luminance of NV12
+    cv::Mat frame = view.format == PIXEL_NV12 ? \
+                    planes.rowRange(0, view.height) : planes;
+
+    int64 start = cv::getTickCount();
+    if (settings.gate && !changeGate) {
+        changeGate.reset(new ChangeDetector( \
+                lanes.geometry().roiPolygon(frame.size()), \
+                settings.gateThreshold, settings.gateMaxReuse));
+        gateSize = frame.size();
+    }
+
+    LaneResult result;
+    if (changeGate && changeGate->isUnchanged(frame)) {
+        // The road ahead looks the same, so we reuse the last polygon
+        result = lanes.reuse(frame);
+    } else if (rateControl.skipFrame()) {
+        // We are falling behind, so we extrapolate the last two lanes
+        result = lanes.extrapolate(frame);
+    } else {
+        LaneStream::Quality quality;
+        quality.scaleFactor = rateControl.scaleFactor();
+        quality.houghFactor = rateControl.houghFactor();
+        quality.smoothing = rateControl.smoothing();
+        result = lanes.detect(planes, quality, view.format);
+        lastDetected = true;
+    }
+
+    if (settings.realtime) {
+        rateControl.update((cv::getTickCount() - start) / \
+                           cv::getTickFrequency());
+    }
+    return result;
+}
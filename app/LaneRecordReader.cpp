@@ -0,0 +1,118 @@
+/************************************************************************************************
+* @file      : Implementation for LaneRecordReader class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneRecordReader class memory-maps a binary lane results file for
+*              random access by frame index
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "LaneRecordReader.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string>
+#include <cstring>
+
+/***
+*@brief  : The open() function maps the whole file read-only and checks the magic
+*          bytes, the version and the header and record sizes. A partially
+*          written last record (for example after a crash) is ignored.
+*@params : path is the location of the results file
+*@return : true if the file was mapped and has a valid header
+*****/
+bool LaneRecordReader::open(const std::string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        lastError = "cannot open " + path;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || \
+            static_cast<size_t>(info.st_size) < sizeof(LaneFileHeader)) {
+        ::close(fd);
+        lastError = path + " is too small for a lane results file";
+        return false;
+    }
+    mappedBytes = static_cast<size_t>(info.st_size);
+    mapping = mmap(nullptr, mappedBytes, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        mappedBytes = 0;
+        lastError = "cannot map " + path;
+        return false;
+    }
+
+    fileHeader = static_cast<const LaneFileHeader *>(mapping);
+    if (std::memcmp(fileHeader->magic, kLaneFileMagic, \
+                    sizeof(kLaneFileMagic)) != 0 || \
+            fileHeader->version != kLaneFileVersion || \
+            fileHeader->headerSize != sizeof(LaneFileHeader) || \
+            fileHeader->recordSize != sizeof(LaneRecord)) {
+        close();
+        lastError = path + " is not a supported lane results file";
+        return false;
+    }
+
+    records = reinterpret_cast<const LaneRecord *>( \
+              static_cast<const char *>(mapping) + sizeof(LaneFileHeader));
+    recordCount = (mappedBytes - sizeof(LaneFileHeader)) / sizeof(LaneRecord);
+    // Sequential scans are the common case, so we ask for read-ahead
+    madvise(mapping, mappedBytes, MADV_SEQUENTIAL);
+    return true;
+}
+
+void LaneRecordReader::close() {
+    if (mapping != nullptr)
+        munmap(mapping, mappedBytes);
+    mapping = nullptr;
+    mappedBytes = 0;
+    fileHeader = nullptr;
+    records = nullptr;
+    recordCount = 0;
+}
+
+/***
+*@brief  : The find() function first looks at the position equal to the frame
+*          index, which is where the record is when a file starts at frame 0.
+*          Otherwise it does a binary search, as records are in frame order.
+*@params : frameIndex is the index of the frame in the input
+*@return : A pointer to the record, or nullptr if the frame is not stored
+*****/
+const LaneRecord *LaneRecordReader::find(uint64_t frameIndex) const {
+    if (frameIndex < recordCount && records[frameIndex].frameIndex == frameIndex)
+        return &records[frameIndex];
+    size_t low = 0, high = recordCount;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (records[middle].frameIndex < frameIndex) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (low < recordCount && records[low].frameIndex == frameIndex)
+        return &records[low];
+    return nullptr;
+}
@@ -0,0 +1,80 @@
+/************************************************************************************************
+* @file      : Lane detection regression tool
+* @author    : Arun Kumar Devarajulu
+* @brief     : The lane-regress tool runs a regression suite through LaneRegression, prints the accuracy
+*              deltas and stage timings of every clip and fails when a clip leaves its tolerances.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include "Arguments.hpp"
+#include "LaneRegression.hpp"
+
+int main(int argc, char *argv[]) {
+    Arguments args(argc, argv);
+    if (args.positional().empty()) {
+        std::cout << "Usage: lane-regress <suite.yml> [--clip=<name>] "
+                     "[--record] [--report=<csv>] [--threads=1]" << std::endl;
+        return -1;
+    }
+
+    std::string error;
+    std::vector<LaneRegression::Clip> clips = \
+        LaneRegression::loadSuite(args.positional().at(0), error);
+    if (clips.empty()) {
+        std::cout << "Error: " << error << std::endl;
+        return -1;
+    }
+
+    // OpenCV threads would make the stage timings depend on the machine load
+    cv::setNumThreads(args.getInt("threads", 1));
+    std::string only = args.getString("clip", "");
+    std::vector<LaneRegression::Report> reports;
+    bool passed = true, recorded = false;
+    for (const LaneRegression::Clip& clip : clips) {
+        if (!only.empty() && clip.config.name != only)
+            continue;
+        reports.push_back(LaneRegression::run(clip, args.has("record")));
+        LaneRegression::Verdict verdict = reports.back().verdict;
+        passed = passed && verdict != LaneRegression::FAILED && \
+                 verdict != LaneRegression::BROKEN;
+        recorded = recorded || verdict == LaneRegression::RECORDED;
+    }
+    if (reports.empty()) {
+        std::cout << "Error: the suite has no clip " << only << std::endl;
+        return -1;
+    }
+
+    LaneRegression::writeTable(std::cout, reports);
+    if (args.has("report")) {
+        std::ofstream report(args.getString("report", ""));
+        LaneRegression::writeCsv(report, reports);
+    }
+    if (recorded) {
+        std::cout << "Review and commit the recorded golden results" \
+                  << std::endl;
+    }
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+/************************************************************************************************
+* @file      : Lane detection regression harness
+* @author    : Arun Kumar Devarajulu
+* @brief     : Implementation of the LaneRegression class, which checks the lanes of a suite of clips
+*              against golden results and measures the throughput of every stage of the chain.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "LaneRegression.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <boost/filesystem.hpp>
+#include "FrameCacheSource.hpp"
+#include "FrameEnumerator.hpp"
+#include "FrameSource.hpp"
+#include "ImageSequenceSource.hpp"
+#include "LanePipeline.hpp"
+#include "LaneRecordReader.hpp"
+#include "ResultSink.hpp"
+
+namespace FS = boost::filesystem;    //! Short form for boost filesystem
+
+namespace {
+/***
+*@brief  : Reads a number of a map, a missing key leaves the value alone
+*****/
+template <typename T>
+void readNumber(const cv::FileNode& node, const char* key, T& value) {
+    if (!node[key].empty() && node[key].isReal())
+        value = static_cast<T>(static_cast<double>(node[key]));
+    else if (!node[key].empty() && node[key].isInt())
+        value = static_cast<T>(static_cast<int>(node[key]));
+}
+
+/***
+*@brief  : Resolves a path of the suite file against its directory
+*****/
+std::string resolve(const FS::path& base, const std::string& path) {
+    if (path.empty() || FS::path(path).is_absolute())
+        return path;
+    return (base / path).string();
+}
+
+/***
+*@brief  : Distance between two points, where two missing (NaN) points are
+*          equal and a point which went missing is infinitely far away
+*****/
+double pointDelta(double ax, double ay, double bx, double by) {
+    bool aFinite = std::isfinite(ax) && std::isfinite(ay);
+    bool bFinite = std::isfinite(bx) && std::isfinite(by);
+    if (aFinite && bFinite)
+        return std::hypot(ax - bx, ay - by);
+    if (aFinite == bFinite)
+        return 0;
+    return std::numeric_limits<double>::infinity();
+}
+}  // namespace
+
+std::vector<LaneRegression::Clip> LaneRegression::loadSuite( \
+        const std::string& path, std::string& error) {
+    std::vector<Clip> clips;
+    cv::FileStorage file(path, cv::FileStorage::READ);
+    if (!file.isOpened()) {
+        error = "cannot open " + path;
+        return clips;
+    }
+    cv::FileNode list = file["clips"];
+    if (!list.isSeq() || list.size() == 0) {
+        error = path + " has no clips sequence";
+        return clips;
+    }
+    FS::path base = FS::path(path).parent_path();
+    for (cv::FileNodeIterator it = list.begin(); it != list.end(); ++it) {
+        const cv::FileNode& node = *it;
+        Clip clip;
+        clip.config.name = "clip" + std::to_string(clips.size());
+        if (!clip.config.read(node, error)) {
+            error = clip.config.name + ": " + error;
+            return std::vector<Clip>();
+        }
+        clip.config.input = resolve(base, clip.config.input);
+        if (!node["golden"].empty() && node["golden"].isString())
+            clip.golden = resolve(base, static_cast<std::string>( \
+                                        node["golden"]));
+        readNumber(node, "frames", clip.frames);
+        readNumber(node, "line_tolerance", clip.lineTolerance);
+        readNumber(node, "polygon_tolerance", clip.polygonTolerance);
+        readNumber(node, "max_mismatched", clip.maxMismatched);
+
+        // A synthetic clip renders its road with the camera of the clip
+        cv::FileNode scene = node["scene"];
+        if (scene.isMap()) {
+            SceneGenerator::Settings& settings = clip.scene;
+            clip.synthetic = true;
+            readNumber(scene, "width", settings.size.width);
+            readNumber(scene, "height", settings.size.height);
+            readNumber(scene, "fps", clip.fps);
+            readNumber(scene, "curvature", settings.curvature);
+            readNumber(scene, "shadows", settings.shadows);
+            readNumber(scene, "noise", settings.noise);
+            readNumber(scene, "speed", settings.speed);
+            readNumber(scene, "seed", settings.seed);
+            int distort = 1;
+            readNumber(scene, "distort", distort);
+            settings.distort = distort != 0;
+            if (scene["left"].isString())
+                settings.left = SceneGenerator::readMarking( \
+                        static_cast<std::string>(scene["left"]), \
+                        settings.left);
+            if (scene["right"].isString())
+                settings.right = SceneGenerator::readMarking( \
+                        static_cast<std::string>(scene["right"]), \
+                        settings.right);
+            settings.camera = clip.config;
+            if (settings.size.area() <= 0 || clip.frames <= 0) {
+                error = clip.config.name + \
+                        ": a scene needs a positive size and frames";
+                return std::vector<Clip>();
+            }
+        } else if (clip.config.input.empty()) {
+            error = clip.config.name + ": input or scene is missing";
+            return std::vector<Clip>();
+        }
+        if (clip.golden.empty()) {
+            error = clip.config.name + ": golden is missing";
+            return std::vector<Clip>();
+        }
+        clips.push_back(clip);
+    }
+    return clips;
+}
+
+LaneRegression::Report LaneRegression::run(const Clip& clip, bool record) {
+    Report report;
+    report.name = clip.config.name;
+
+    std::unique_ptr<FrameEnumerator> frameList;
+    std::unique_ptr<FrameSource> source;
+    const std::string& input = clip.config.input;
+    if (clip.synthetic) {
+        source.reset(new SceneSource(clip.scene, clip.frames, clip.fps));
+    } else if (!FS::exists(input)) {
+        // Recorded footage is not always available, such as on CI machines
+        report.verdict = SKIPPED;
+        report.message = "no such file " + input;
+        return report;
+    } else if (FrameCacheSource::isCache(input)) {
+        source.reset(new FrameCacheSource(input));
+    } else if (FS::is_directory(input)) {
+        frameList.reset(new FrameEnumerator(input));
+        FrameEnumerator* list = frameList.get();
+        source.reset(new ImageSequenceSource( \
+            [list](std::string& path) { return list->next(path); }, \
+            2, clip.fps));
+    } else {
+        source.reset(new VideoSource(input));
+    }
+    if (!source->isOpened()) {
+        report.message = "cannot open " + input;
+        return report;
+    }
+
+    report.frameSize = source->frameSize();
+    const LaneConfig& config = clip.config;
+    LaneFileHeader header = BinarySink::makeHeader(source->frameSize(), \
+            config.camParams, config.distCoeffs, config.whiteMin, \
+            config.whiteMax, config.yellowMin, config.yellowMax, \
+            config.processScale);
+    // Missing golden results fail the clip, so that a suite can never pass
+    // by recording its own expectations
+    bool writing = record;
+    LaneRecordReader golden;
+    std::unique_ptr<BinarySink> sink;
+    if (!writing && !FS::exists(clip.golden)) {
+        report.verdict = FAILED;
+        report.message = "no golden results " + clip.golden + \
+                         ", record them with --record";
+        return report;
+    }
+    if (writing) {
+        FS::path folder = FS::path(clip.golden).parent_path();
+        if (!folder.empty())
+            FS::create_directories(folder);
+        sink.reset(new BinarySink(clip.golden, header));
+    } else if (!golden.open(clip.golden)) {
+        report.message = golden.error();
+        return report;
+    } else if (golden.header().width != header.width || \
+               golden.header().height != header.height || \
+               golden.header().calibrationHash != header.calibrationHash) {
+        report.message = "golden results of another resolution or camera";
+        return report;
+    }
+
+    LanePipeline::Options options;
+    options.config = config;
+    LanePipeline pipeline(options);
+    cv::Mat frame;
+    double polygonSum = 0;
+    while ((clip.frames <= 0 || report.frames < clip.frames) && \
+           source->read(frame)) {
+        int64 start = cv::getTickCount();
+        LaneResult result = pipeline.process(LanePipeline::view(frame));
+        report.seconds += (cv::getTickCount() - start) / \
+                          cv::getTickFrequency();
+        if (writing) {
+            sink->write(frame, result);
+        } else if (static_cast<size_t>(report.frames) < golden.size()) {
+            const LaneRecord& expected = golden.at(report.frames);
+            LaneRecord actual = BinarySink::toRecord(result);
+            double lineDelta, polygonDelta;
+            compare(expected, actual, lineDelta, polygonDelta);
+            report.maxLineDelta = std::max(report.maxLineDelta, lineDelta);
+            report.maxPolygonDelta = std::max(report.maxPolygonDelta, \
+                                              polygonDelta);
+            polygonSum += polygonDelta;
+            if (lineDelta > clip.lineTolerance || \
+                polygonDelta > clip.polygonTolerance)
+                report.mismatched++;
+            if (expected.status != actual.status || \
+                expected.turn != actual.turn)
+                report.statusChanges++;
+        }
+        report.frames++;
+    }
+    report.stages = pipeline.stream().stageTimes();
+    long compared = std::min<long>(report.frames, golden.size());
+    if (compared > 0)
+        report.meanPolygonDelta = polygonSum / compared;
+
+    if (report.frames == 0) {
+        report.message = "no frames in " + input;
+    } else if (writing) {
+        sink->close();
+        report.verdict = RECORDED;
+        report.message = "golden results written to " + clip.golden;
+    } else if (static_cast<size_t>(report.frames) != golden.size()) {
+        report.verdict = FAILED;
+        report.message = std::to_string(report.frames) + \
+                         " frames, the golden results have " + \
+                         std::to_string(golden.size());
+    } else {
+        report.verdict = report.mismatched > clip.maxMismatched ? \
+                         FAILED : PASSED;
+        if (report.verdict == FAILED)
+            report.message = std::to_string(report.mismatched) + \
+                             " frames outside the tolerances";
+    }
+    return report;
+}
+
+void LaneRegression::compare(const LaneRecord& golden, \
+                             const LaneRecord& actual, \
+                             double& lineDelta, double& polygonDelta) {
+    lineDelta = 0;
+    polygonDelta = 0;
+    for (int i = 0; i < 4; i += 2) {
+        lineDelta = std::max(lineDelta, pointDelta( \
+                golden.leftLine[i], golden.leftLine[i + 1], \
+                actual.leftLine[i], actual.leftLine[i + 1]));
+        lineDelta = std::max(lineDelta, pointDelta( \
+                golden.rightLine[i], golden.rightLine[i + 1], \
+                actual.rightLine[i], actual.rightLine[i + 1]));
+    }
+    for (int i = 0; i < 8; i += 2) {
+        polygonDelta = std::max(polygonDelta, pointDelta( \
+                golden.polygon[i], golden.polygon[i + 1], \
+                actual.polygon[i], actual.polygon[i + 1]));
+    }
+}
+
+void LaneRegression::writeTable(std::ostream& out, \
+                                const std::vector<Report>& reports) {
+    out << std::left << std::setw(20) << "clip" << std::right \
+        << std::setw(8) << "frames" << std::setw(9) << "fps" \
+        << std::setw(9) << "prep ms" << std::setw(9) << "mask ms" \
+        << std::setw(9) << "edge ms" << std::setw(9) << "hough ms" \
+        << std::setw(9) << "poly ms" << std::setw(10) << "line px" \
+        << std::setw(10) << "poly px" << std::setw(10) << "outside" \
+        << "  result" << std::endl;
+    out << std::fixed << std::setprecision(2);
+    for (const Report& report : reports) {
+        const LaneStream::StageTimes& stages = report.stages;
+        double perFrame = stages.frames > 0 ? 1000.0 / stages.frames : 0;
+        out << std::left << std::setw(20) << report.name << std::right \
+            << std::setw(8) << report.frames << std::setw(9) \
+            << (report.seconds > 0 ? report.frames / report.seconds : 0) \
+            << std::setw(9) << stages.prepare * perFrame \
+            << std::setw(9) << stages.threshold * perFrame \
+            << std::setw(9) << stages.edges * perFrame \
+            << std::setw(9) << stages.hough * perFrame \
+            << std::setw(9) << stages.polygon * perFrame \
+            << std::setw(10) << report.maxLineDelta \
+            << std::setw(10) << report.maxPolygonDelta \
+            << std::setw(10) << report.mismatched \
+            << "  " << verdictName(report.verdict);
+        if (!report.message.empty())
+            out << " (" << report.message << ")";
+        out << std::endl;
+    }
+    out.unsetf(std::ios::floatfield);
+}
+
+void LaneRegression::writeCsv(std::ostream& out, \
+                              const std::vector<Report>& reports) {
+    out << "clip,frames,fps,prepare_ms,threshold_ms,edges_ms,hough_ms," \
+        << "polygon_ms,max_line_delta,max_polygon_delta,mean_polygon_delta," \
+        << "mismatched,status_changes,result\n";
+    for (const Report& report : reports) {
+        const LaneStream::StageTimes& stages = report.stages;
+        double perFrame = stages.frames > 0 ? 1000.0 / stages.frames : 0;
+        out << report.name << "," << report.frames << "," \
+            << (report.seconds > 0 ? report.frames / report.seconds : 0) \
+            << "," << stages.prepare * perFrame \
+            << "," << stages.threshold * perFrame \
+            << "," << stages.edges * perFrame \
+            << "," << stages.hough * perFrame \
+            << "," << stages.polygon * perFrame \
+            << "," << report.maxLineDelta << "," << report.maxPolygonDelta \
+            << "," << report.meanPolygonDelta << "," << report.mismatched \
+            << "," << report.statusChanges << "," \
+            << verdictName(report.verdict) << "\n";
+    }
+}
+
+const char* LaneRegression::verdictName(Verdict verdict) {
+    switch (verdict) {
+        case PASSED: return "PASSED";
+        case FAILED: return "FAILED";
+        case RECORDED: return "RECORDED";
+        case SKIPPED: return "SKIPPED";
+        default: return "BROKEN";
+    }
+}
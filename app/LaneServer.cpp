@@ -0,0 +1,467 @@
+/************************************************************************************************
+* @file      : Implementation for LaneServer class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneServer class serves lane detection jobs over a UNIX domain socket
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "LaneServer.hpp"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <boost/filesystem.hpp>
+#include "FrameEnumerator.hpp"
+#include "FrameCacheSource.hpp"
+#include "FrameRing.hpp"
+#include "FrameSource.hpp"
+#include "ImageSequenceSource.hpp"
+#include "ResultSink.hpp"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace {
+typedef std::chrono::steady_clock Clock;
+
+// Frames of a job run by one task before the other jobs get their turn
+const int kFramesPerStep = 8;
+// Longest request line a client may send
+const size_t kMaxRequest = 4096;
+// Longest a ring job holds its worker waiting for a frame before the
+// other jobs get their turn
+const double kRingSlice = 0.02;
+
+/***
+*@brief  : Sends a whole buffer to a client
+*@return : false once the client has gone away
+*****/
+bool sendAll(int fd, const std::string& text) {
+    size_t sent = 0;
+    while (sent < text.size()) {
+        ssize_t count = send(fd, text.data() + sent, text.size() - sent, \
+                             MSG_NOSIGNAL);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            return false;
+        sent += static_cast<size_t>(count);
+    }
+    return true;
+}
+}  // namespace
+
+/***
+*@brief  : One request of a client and the state of its input
+*****/
+struct LaneServer::Job {
+    unsigned long id = 0;   // < Number of the job within its client
+    std::string kind;   // < FILE or RING
+    std::string input;   // < Path or ring name
+    std::unique_ptr<FrameEnumerator> frameList;   // < Directory listing
+    std::unique_ptr<FrameSource> source;   // < Frames of a FILE job
+    std::unique_ptr<FrameRing> ring;   // < Frames of a RING job
+    std::unique_ptr<LanePipeline> pipeline;   // < Set once the job runs
+    long frames = 0;   // < Results sent
+    Clock::time_point started;   // < Time the input was opened
+    Clock::time_point lastFrame;   // < Time a ring job last got a frame
+};
+
+/***
+*@brief  : A connection and its queue of jobs. The socket is closed when the
+*          last task of the client lets go of it.
+*****/
+struct LaneServer::Client {
+    int fd = -1;   // < Connected socket
+    size_t id = 0;   // < Number of the connection
+    std::thread reader;   // < Thread of readLoop()
+    std::atomic<bool> readerDone{false};   // < The client stopped sending
+    std::mutex lock;   // < Guards the members below
+    std::deque<std::unique_ptr<Job>> pending;   // < Jobs waiting to run
+    std::unique_ptr<Job> current;   // < Job being run
+    unsigned long nextJob = 1;   // < Number of the next request
+    bool gone = false;   // < A send failed, the jobs are cancelled
+
+    ~Client() {
+        if (fd >= 0)
+            ::close(fd);
+    }
+};
+
+LaneServer::LaneServer(const Options& options) : settings(options), \
+    stopping(false), finishedJobs(0), acceptedClients(0) {}
+
+LaneServer::~LaneServer() {
+    stop();
+}
+
+bool LaneServer::start() {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (settings.socketPath.empty() || \
+        settings.socketPath.size() >= sizeof(address.sun_path)) {
+        lastError = "the socket path must have 1 to " + \
+                    std::to_string(sizeof(address.sun_path) - 1) + " characters";
+        return false;
+    }
+    std::strncpy(address.sun_path, settings.socketPath.c_str(), \
+                 sizeof(address.sun_path) - 1);
+
+    // A socket file nobody listens on is left over from a crashed server
+    int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe >= 0 && connect(probe, reinterpret_cast<sockaddr*>(&address), \
+                              sizeof(address)) == 0) {
+        ::close(probe);
+        lastError = "a server is already listening on " + settings.socketPath;
+        return false;
+    }
+    if (probe >= 0)
+        ::close(probe);
+    unlink(settings.socketPath.c_str());
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0 || \
+        bind(listenFd, reinterpret_cast<sockaddr*>(&address), \
+             sizeof(address)) != 0 || \
+        listen(listenFd, SOMAXCONN) != 0) {
+        lastError = "cannot listen on " + settings.socketPath + ": " + \
+                    std::strerror(errno);
+        if (listenFd >= 0)
+            ::close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    // Every worker gets a pipeline which has already built its undistortion
+    // maps and buffers for frames of the calibration size
+    int workers = std::max(1, settings.threads);
+    cv::Mat blank = cv::Mat::zeros(settings.pipeline.config.calibrationSize, \
+                                   CV_8UC3);
+    for (int i = 0; i < workers; i++) {
+        std::unique_ptr<LanePipeline> pipeline( \
+            new LanePipeline(settings.pipeline));
+        pipeline->process(LanePipeline::view(blank));
+        pipeline->restart();
+        checkin(std::move(pipeline));
+    }
+
+    stopping = false;
+    pool.reset(new ThreadPool(workers, settings.cores));
+    acceptor = std::thread(&LaneServer::acceptLoop, this);
+    return true;
+}
+
+void LaneServer::stop() {
+    if (listenFd < 0)
+        return;
+    stopping = true;
+    if (acceptor.joinable())
+        acceptor.join();
+    ::close(listenFd);
+    listenFd = -1;
+    unlink(settings.socketPath.c_str());
+    {
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        for (auto& client : clients)
+            shutdown(client->fd, SHUT_RDWR);
+    }
+    reap(true);
+    // The running steps see stopping and end their jobs without submitting
+    // more, so the pool drains before it goes away
+    pool->wait();
+    pool.reset();
+}
+
+void LaneServer::acceptLoop() {
+    while (!stopping) {
+        pollfd listening;
+        listening.fd = listenFd;
+        listening.events = POLLIN;
+        listening.revents = 0;
+        int ready = poll(&listening, 1, 200);
+        reap(false);
+        if (ready <= 0)
+            continue;
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0)
+            continue;
+        std::shared_ptr<Client> client(new Client());
+        client->fd = fd;
+        client->id = ++acceptedClients;
+        {
+            std::lock_guard<std::mutex> lock(logMutex);
+            *settings.log << "Client " << client->id << " connected" \
+                          << std::endl;
+        }
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        clients.push_back(client);
+        client->reader = std::thread(&LaneServer::readLoop, this, client);
+    }
+}
+
+void LaneServer::readLoop(std::shared_ptr<Client> client) {
+    std::string buffer;
+    char chunk[4096];
+    for (;;) {
+        ssize_t count = recv(client->fd, chunk, sizeof(chunk), 0);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            break;
+        buffer.append(chunk, static_cast<size_t>(count));
+        size_t end;
+        while ((end = buffer.find('\n')) != std::string::npos) {
+            std::string line = buffer.substr(0, end);
+            buffer.erase(0, end + 1);
+            if (!line.empty() && line[line.size() - 1] == '\r')
+                line.erase(line.size() - 1);
+            if (!line.empty())
+                request(client, line);
+        }
+        // Nothing sensible sends requests this long, stop listening to it
+        if (buffer.size() > kMaxRequest)
+            break;
+    }
+    // The queued jobs still run, a client may close its sending side once
+    // it has sent all its requests
+    client->readerDone = true;
+}
+
+void LaneServer::request(const std::shared_ptr<Client>& client, \
+                         const std::string& line) {
+    std::unique_ptr<Job> job(new Job());
+    size_t space = line.find(' ');
+    job->kind = line.substr(0, space);
+    if (space != std::string::npos)
+        job->input = line.substr(space + 1);
+    {
+        std::lock_guard<std::mutex> lock(client->lock);
+        if (client->gone)
+            return;
+        job->id = client->nextJob++;
+        client->pending.push_back(std::move(job));
+    }
+    startNext(client);
+}
+
+void LaneServer::startNext(const std::shared_ptr<Client>& client) {
+    std::lock_guard<std::mutex> lock(client->lock);
+    if (stopping)
+        client->pending.clear();
+    if (client->current || client->pending.empty())
+        return;
+    client->current = std::move(client->pending.front());
+    client->pending.pop_front();
+    std::shared_ptr<Client> owner = client;
+    pool->submit([this, owner] { step(owner); });
+}
+
+void LaneServer::step(std::shared_ptr<Client> client) {
+    Job& job = *client->current;
+    if (stopping) {
+        finish(client, "ERROR " + std::to_string(job.id) + \
+                       " server stopping\n");
+        return;
+    }
+    if (!job.pipeline) {
+        std::string problem = open(job);
+        if (!problem.empty()) {
+            finish(client, "ERROR " + std::to_string(job.id) + " " + \
+                           problem + "\n");
+            return;
+        }
+        job.pipeline = checkout();
+        job.started = Clock::now();
+        job.lastFrame = job.started;
+    }
+
+    // A batch of frames is answered with one send
+    std::ostringstream replies;
+    replies << std::fixed << std::setprecision(3);
+    bool more = true;
+    for (int i = 0; i < kFramesPerStep && more; i++) {
+        LaneResult result;
+        if (job.ring) {
+            FrameView view;
+            FrameRing::FrameInfo info;
+            // An idle ring only holds the worker for one short wait. The
+            // step then sends what is ready and queues itself again behind
+            // the other jobs until the ring timeout has passed
+            more = job.ring->next(view, info, kRingSlice);
+            if (!more) {
+                double idle = std::chrono::duration<double>( \
+                    Clock::now() - job.lastFrame).count();
+                more = job.ring->timedOut() && idle < settings.ringTimeout;
+                break;
+            }
+            job.lastFrame = Clock::now();
+            result = job.pipeline->process(view);
+            if (!job.ring->intact(info.sequence))
+                continue;
+            result.frameIndex = static_cast<long>(info.sequence);
+        } else {
+            cv::Mat frame;
+            more = job.source->read(frame);
+            if (!more)
+                break;
+            result = job.pipeline->process(LanePipeline::view(frame, \
+                                           job.source->format()));
+        }
+        replies << "FRAME " << job.id << " ";
+        CsvSink::writeRow(replies, result);
+        replies << "\n";
+        job.frames++;
+    }
+    if (!sendAll(client->fd, replies.str())) {
+        {
+            std::lock_guard<std::mutex> lock(client->lock);
+            client->gone = true;
+        }
+        finish(client, "");
+        return;
+    }
+    if (stopping) {
+        finish(client, "ERROR " + std::to_string(job.id) + \
+                       " server stopping\n");
+        return;
+    }
+    if (more) {
+        pool->submit([this, client] { step(client); });
+        return;
+    }
+
+    double seconds = std::chrono::duration<double>( \
+        Clock::now() - job.started).count();
+    double rate = seconds > 0 ? job.frames / seconds : 0;
+    std::ostringstream reply;
+    if (job.ring && job.ring->timedOut()) {
+        reply << "ERROR " << job.id << " no frame for " \
+              << settings.ringTimeout << " s after " << job.frames \
+              << " frames\n";
+    } else {
+        reply << "DONE " << job.id << " " << job.frames << " " \
+              << std::fixed << std::setprecision(3) << seconds << " " \
+              << rate << "\n";
+        finishedJobs++;
+    }
+    {
+        std::lock_guard<std::mutex> lock(logMutex);
+        *settings.log << "Client " << client->id << " job " << job.id \
+                      << ": " << job.frames << " frames of " << job.input \
+                      << " in " << seconds << " s (" << rate \
+                      << " frames/s)";
+        if (job.ring) {
+            *settings.log << ", " << job.ring->dropped() << " dropped, " \
+                          << job.ring->torn() << " overwritten";
+        }
+        *settings.log << std::endl;
+    }
+    finish(client, reply.str());
+}
+
+std::string LaneServer::open(Job& job) {
+    if (job.kind == "FILE") {
+        if (job.input.empty())
+            return "FILE needs a video, frame cache or frame directory";
+        if (FrameCacheSource::isCache(job.input)) {
+            job.source.reset(new FrameCacheSource(job.input));
+        } else if (boost::filesystem::is_directory(job.input)) {
+            job.frameList.reset(new FrameEnumerator(job.input));
+            FrameEnumerator* list = job.frameList.get();
+            job.source.reset(new ImageSequenceSource( \
+                [list](std::string& path) { return list->next(path); }, \
+                1, 30));
+        } else if (boost::filesystem::exists(job.input)) {
+            job.source.reset(new VideoSource(job.input));
+        } else {
+            return "no such file " + job.input;
+        }
+        if (!job.source->isOpened())
+            return "cannot open " + job.input;
+        return "";
+    }
+    if (job.kind == "RING") {
+        job.ring.reset(new FrameRing());
+        if (!job.ring->attach(job.input))
+            return job.ring->error();
+        return "";
+    }
+    return "unknown request " + job.kind;
+}
+
+void LaneServer::finish(const std::shared_ptr<Client>& client, \
+                        const std::string& reply) {
+    Job& job = *client->current;
+    if (!reply.empty() && !sendAll(client->fd, reply)) {
+        std::lock_guard<std::mutex> lock(client->lock);
+        client->gone = true;
+    }
+    if (job.source)
+        job.source->release();
+    if (job.pipeline) {
+        job.pipeline->restart();
+        checkin(std::move(job.pipeline));
+    }
+    {
+        std::lock_guard<std::mutex> lock(client->lock);
+        client->current.reset();
+        if (client->gone)
+            client->pending.clear();
+    }
+    startNext(client);
+}
+
+std::unique_ptr<LanePipeline> LaneServer::checkout() {
+    std::lock_guard<std::mutex> lock(idleMutex);
+    if (idle.empty())
+        return std::unique_ptr<LanePipeline>( \
+            new LanePipeline(settings.pipeline));
+    std::unique_ptr<LanePipeline> pipeline = std::move(idle.back());
+    idle.pop_back();
+    return pipeline;
+}
+
+void LaneServer::checkin(std::unique_ptr<LanePipeline> pipeline) {
+    std::lock_guard<std::mutex> lock(idleMutex);
+    idle.push_back(std::move(pipeline));
+}
+
+void LaneServer::reap(bool all) {
+    std::lock_guard<std::mutex> lock(clientsMutex);
+    for (auto client = clients.begin(); client != clients.end();) {
+        if (all || (*client)->readerDone) {
+            (*client)->reader.join();
+            client = clients.erase(client);
+        } else {
+            ++client;
+        }
+    }
+}
@@ -0,0 +1,599 @@
+/************************************************************************************************
+* @file      : Implementation for LaneStream class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneStream class runs the lane detection chain on the frames of one video
+*              stream with chain objects and lane history owned by the stream
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "LaneStream.hpp"
+#include <unistd.h>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <cmath>
+#include <cstdlib>
+#include "RateController.hpp"
+
+namespace {
+/***
+*@brief  : Converts an image of the given PixelFormat to BGR, BGR images are
+*          returned as they are
+*****/
+cv::Mat toBgr(const cv::Mat& image, int format) {
+    int code;
+    switch (format) {
+        case PIXEL_RGB: code = cv::COLOR_RGB2BGR; break;
+        case PIXEL_BGRA: code = cv::COLOR_BGRA2BGR; break;
+        case PIXEL_RGBA: code = cv::COLOR_RGBA2BGR; break;
+        case PIXEL_GRAY: code = cv::COLOR_GRAY2BGR; break;
+        case PIXEL_NV12: code = cv::COLOR_YUV2BGR_NV12; break;
+        default: return image;
+    }
+    cv::Mat bgr;
+    cv::cvtColor(image, bgr, code);
+    return bgr;
+}
+
+/***
+*@brief  : Rows of a band whose images of all the per-pixel stages fit in half
+*          of the L2 cache: the source, undistorted, blurred and L*a*b rows of
+*          three bytes per pixel, six bytes of remap tables and two masks
+*****/
+int cacheBandRows(int width) {
+    long cache = 0;
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    cache = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+    if (cache <= 0)
+        cache = 1L << 20;
+    long rowBytes = std::max(1L, static_cast<long>(width) * 20);
+    return static_cast<int>(std::max(16L, cache / 2 / rowBytes));
+}
+
+/***
+*@brief  : Runs the undistortion, the gaussian blur and the fused L*a*b masks
+*          and region of interest on bands of rows, each band through all the
+*          stages before the next one starts. A band is undistorted with the
+*          halo rows the blur needs, so its rows come out identical to those
+*          of the whole frame stages.
+*****/
+class BandMasker : public cv::ParallelLoopBody {
+ public:
+    BandMasker(const Cleaner& cleaner, const Thresholder& thresholder, \
+               const cv::Mat& frame, const cv::Mat& roi, cv::Mat& lanes, \
+               cv::Mat& interest, int rows, bool smoothing) : \
+        undistorter(cleaner), masker(thresholder), source(frame), \
+        roiMask(roi), lanesMask(lanes), interestLanes(interest), \
+        bandRows(rows), halo(smoothing ? cleaner.kernel() / 2 : 0), \
+        blur(smoothing) {}
+
+    void operator()(const cv::Range& range) const override {
+        cv::Mat undistorted, blurred;
+        for (int band = range.start; band < range.end; band++) {
+            int first = band * bandRows;
+            int last = std::min(source.rows, first + bandRows);
+            int top = std::max(0, first - halo);
+            int bottom = std::min(source.rows, last + halo);
+            undistorter.remapRows(source, top, bottom, undistorted);
+            if (blur)
+                undistorter.smoothen(undistorted, blurred);
+            else
+                blurred = undistorted;
+            cv::Mat lanes = lanesMask.rowRange(first, last);
+            cv::Mat interest = interestLanes.rowRange(first, last);
+            masker.maskRows(blurred.rowRange(first - top, last - top), \
+                            roiMask.rowRange(first, last), lanes, interest);
+        }
+    }
+
+ private:
+    const Cleaner& undistorter;   // < Undistortion maps and blur kernel
+    const Thresholder& masker;   // < White and yellow thresholds
+    const cv::Mat& source;   // < Frame at the processing size
+    const cv::Mat& roiMask;   // < Region of interest
+    cv::Mat lanesMask;   // < Combined lanes mask of the whole frame
+    cv::Mat interestLanes;   // < Lanes inside the region of interest
+    int bandRows;   // < Rows per band
+    int halo;   // < Extra rows the blur needs on either side
+    bool blur;   // < Whether the gaussian blur is applied
+};
+
+/***
+*@brief  : Adds the seconds since a tick count to a stage and restarts it
+*****/
+void lap(int64& tick, double& stage) {
+    int64 now = cv::getTickCount();
+    stage += (now - tick) / cv::getTickFrequency();
+    tick = now;
+}
+}  // namespace
+
+LaneStream::LaneStream(const LaneConfig& config) : settings(config), \
+    fullGeometry(config.processScale, config.roi, config.calibrationSize), \
+    reducedGeometry(config.processScale * 0.5, config.roi, \
+                    config.calibrationSize), \
+    cleaner(config.camParams, config.distCoeffs, config.gaussKernel), \
+    chromaCleaner(config.camParams, config.distCoeffs, \
+                  config.gaussKernel / 2 | 1), \
+    thresholder(config.whiteMin, config.whiteMax, config.yellowMin, \
+                config.yellowMax), \
+    historicLane(4, cv::Point(0, 0)), olderLane(4, cv::Point(0, 0)) {}
+
+void LaneStream::restart() {
+    fitter.reset();
+    historicLane.assign(4, cv::Point(0, 0));
+    olderLane.assign(4, cv::Point(0, 0));
+    leftLine = std::pair<cv::Point2d, cv::Point2d>();
+    rightLine = std::pair<cv::Point2d, cv::Point2d>();
+    counter = 1;
+    historicFrame = 0;
+    olderFrame = 0;
+}
+
+LaneStream::State LaneStream::state() const {
+    State saved;
+    saved.counter = counter;
+    saved.procSize = procSize;
+    saved.historicLane = historicLane;
+    saved.olderLane = olderLane;
+    saved.leftLine = leftLine;
+    saved.rightLine = rightLine;
+    saved.leftFit = fitter.left();
+    saved.rightFit = fitter.right();
+    saved.tracking = fitter.tracking();
+    saved.times = times;
+    return saved;
+}
+
+/***
+*@brief  : The restore() function keeps the chain of the current processing
+*          size, the next frame prepares it again when the size differs
+*****/
+void LaneStream::restore(const State& saved) {
+    counter = saved.counter;
+    procSize = saved.procSize;
+    historicLane = saved.historicLane;
+    olderLane = saved.olderLane;
+    leftLine = saved.leftLine;
+    rightLine = saved.rightLine;
+    fitter.restore(saved.leftFit, saved.rightFit, saved.tracking);
+    times = saved.times;
+    historicFrame = 0;
+    olderFrame = 0;
+}
+
+LaneResult LaneStream::detect(const cv::Mat& frame, const Quality& quality, \
+                              int format) {
+    /*****************************************************************
+    *
+    *  To begin with, we grab the image frames and do pre-processing
+    *
+    ******************************************************************/
+
+    bool planar = format == PIXEL_NV12 && settings.engine == ENGINE_HOUGH;
+    if (planar)
+        thresholder.calibrateYuv();
+    int64 tick = cv::getTickCount();
+    const LaneGeometry& geometry = quality.scaleFactor < 1.0 ? \
+                                   reducedGeometry : fullGeometry;
+    cv::Size frameSize(frame.cols, format == PIXEL_NV12 ? \
+                       frame.rows / 3 * 2 : frame.rows);
+    cv::Mat procFrame, procChroma;
+    if (planar) {
+        // The luminance and the chroma plane are downscaled one by one
+        procFrame = geometry.downscale(frame.rowRange(0, frameSize.height));
+        procChroma = geometry.downscale(frame.rowRange(frameSize.height, \
+                                                       frame.rows).reshape(2));
+        cv::Size chromaHalf((procFrame.cols + 1) / 2, \
+                            (procFrame.rows + 1) / 2);
+        if (procChroma.size() != chromaHalf) {
+            cv::Mat resized;
+            cv::resize(procChroma, resized, chromaHalf, 0, 0, cv::INTER_AREA);
+            procChroma = resized;
+        }
+    } else if (format == PIXEL_NV12) {
+        procFrame = geometry.downscale(toBgr(frame, format));
+    } else {
+        procFrame = toBgr(geometry.downscale(frame), format);
+    }
+    if (procSize != procFrame.size() && procSize.area() > 0) {
+        // The lanes history follows a change of processing scale
+        historicLane = fullGeometry.toFrame(historicLane, procSize, \
+                                            procFrame.size());
+        olderLane = fullGeometry.toFrame(olderLane, procSize, \
+                                         procFrame.size());
+    }
+    procSize = procFrame.size();
+    if (chainSize != procSize) {
+        chainSize = procSize;
+        cleaner = Cleaner(fullGeometry.cameraMatrix(settings.camParams, \
+                                                    procSize), \
+                          settings.distCoeffs, settings.gaussKernel);
+        marker = LanesMarker(fullGeometry.lineExtent(procSize));
+        regions = RegionMaker(fullGeometry.polygonTopRow(procSize), \
+                              fullGeometry.polygonBottomRow(procSize));
+        if (settings.engine == ENGINE_WINDOW)
+            prepareBirdsEye();
+    }
+
+    bool smoothing = quality.smoothing && settings.gaussKernel >= 3;
+    std::vector<cv::Point> polyRegionVertices = \
+        settings.engine == ENGINE_WINDOW ? \
+        windowLanes(procFrame, smoothing, tick) : \
+        houghLanes(procFrame, procChroma, quality, smoothing, tick);
+
+    unsigned status = 0;
+    for (auto& vertex : polyRegionVertices) {
+        if (vertex.x == 0 || vertex.y == 0) {
+            polyRegionVertices = historicLane;
+            status |= STATUS_HISTORIC;
+            break;
+        }
+    }
+    int tolerance = fullGeometry.jumpTolerance(procSize);
+    if (counter > 1 && ((std::abs(polyRegionVertices.at(2).x - \
+                                  historicLane.at(2).x) > tolerance) ||
+                        std::abs(polyRegionVertices.at(3).x - \
+                                 historicLane.at(3).x) > tolerance)) {
+        polyRegionVertices = historicLane;
+        status |= STATUS_HISTORIC;
+    }
+    // A rejected fit is not tracked into the next frame
+    if (status & STATUS_HISTORIC)
+        fitter.reset();
+
+    olderLane = historicLane;
+    historicLane = polyRegionVertices;
+    olderFrame = historicFrame;
+    historicFrame = counter;
+    LaneResult result = finish(polyRegionVertices, status, frameSize);
+    lap(tick, times.polygon);
+    times.frames++;
+    return result;
+}
+
+std::vector<cv::Point> LaneStream::houghLanes(const cv::Mat& procFrame, \
+                                              const cv::Mat& procChroma, \
+                                              const Quality& quality, \
+                                              bool smoothing, int64& tick) {
+    std::vector<cv::Point> procRoi = fullGeometry.roiPolygon(procSize);
+    cv::Mat firstPolygonArea(procSize, CV_8U, cv::Scalar(0));
+    cv::fillConvexPoly(firstPolygonArea, procRoi, cv::Scalar(1));
+    cv::Mat lanesMask, interestLanes;
+    if (!procChroma.empty()) {
+        maskPlanes(procFrame, procChroma, smoothing, firstPolygonArea, \
+                   lanesMask, interestLanes, tick);
+    } else if (settings.bandRows != 0) {
+        maskBands(procFrame, smoothing, firstPolygonArea, lanesMask, \
+                  interestLanes);
+        lap(tick, times.prepare);
+    } else {
+        maskFrame(procFrame, smoothing, firstPolygonArea, lanesMask, \
+                  interestLanes, tick);
+    }
+    maskView = lanesMask;
+
+    /*****************************************************************
+    *
+    *   Later we employ a gradient based edge detector to detect
+    *   sharp edges which will be our lanes
+    *
+    ******************************************************************/
+
+    cv::Mat edges = cv::Mat::zeros(lanesMask.size(), CV_8U);
+    cv::Canny(interestLanes, edges, settings.cannyLow, settings.cannyHigh, 3);
+    edgeView = edges;
+    lap(tick, times.edges);
+
+    /******************************************************************
+    *
+    *  Later we strengthen the detected edges by drawinng Hough Lines
+    *  on top of their loci
+    *
+    *******************************************************************/
+
+    lines.clear();
+    cv::HoughLines(edges, lines, settings.houghRho * quality.houghFactor, \
+                   settings.houghTheta * quality.houghFactor, \
+                   settings.houghThreshold, 0, 0);
+    marker.lanesSegregator(lines);
+    leftLine = marker.leftLanesAverage();
+    rightLine = marker.rightLanesAverage();
+    cv::Mat black_img = cv::Mat::zeros(procSize, CV_8UC3);
+    cv::line(black_img, leftLine.first, leftLine.second, \
+             cv::Scalar(0, 0, 255), 3, cv::LINE_AA);
+    cv::line(black_img, rightLine.first, rightLine.second, \
+             cv::Scalar(0, 0, 255), 3, cv::LINE_AA);
+    houghView = black_img;
+    lap(tick, times.hough);
+
+    /*****************************************************************
+    *
+    *  Later we draw polygonal region on the road which denotes a
+    *  region within the bounds of two lanes in front of the vehicle
+    *
+    ******************************************************************/
+
+    cv::Mat polygonLayer = cv::Mat::zeros(procSize, CV_8UC3);
+    cv::Mat linesCanny = polygonLayer.clone();
+    black_img.copyTo(polygonLayer, firstPolygonArea);
+    cv::Canny(polygonLayer, linesCanny, settings.polygonCannyLow, \
+              settings.polygonCannyHigh, 3);
+    cv::Mat binaryRegions;
+    cv::findNonZero(linesCanny, binaryRegions);
+    return regions.getPolygonVertices(binaryRegions);
+}
+
+/*********************************************************************
+*
+*  The window engine warps only the road area into a small top-down
+*  view, masks its lanes and fits a curve to each of them, so it has
+*  no edge image, line accumulator or polygon search
+*
+*********************************************************************/
+
+std::vector<cv::Point> LaneStream::windowLanes(const cv::Mat& procFrame, \
+                                               bool smoothing, int64& tick) {
+    cv::Mat view;
+    cleaner.birdsEye(procFrame, view);
+    if (smoothing) {
+        cv::Mat blurred;
+        cleaner.smoothen(view, blurred);
+        view = blurred;
+    }
+    lap(tick, times.prepare);
+
+    cv::Mat lanesMask, viewLanes;
+    thresholder.maskRows(view, cv::Mat(), lanesMask, viewLanes);
+    maskView = lanesMask;
+    edgeView = viewLanes;
+    lap(tick, times.threshold);
+
+    std::vector<cv::Point> polygon(4, cv::Point(0, 0));
+    cv::Mat black_img = cv::Mat::zeros(procSize, CV_8UC3);
+    houghView = black_img;
+    if (!fitter.fit(lanesMask)) {
+        lap(tick, times.hough);
+        return polygon;
+    }
+
+    // The fitted curves are sampled from the top of the view downwards
+    const int samples = 16;
+    std::vector<cv::Point2f> leftCurve, rightCurve;
+    for (int i = 0; i <= samples; ++i) {
+        double row = static_cast<double>(view.rows - 1) * i / samples;
+        leftCurve.push_back(cv::Point2f(static_cast<float>( \
+            LaneFitter::evaluate(fitter.left(), row)), row));
+        rightCurve.push_back(cv::Point2f(static_cast<float>( \
+            LaneFitter::evaluate(fitter.right(), row)), row));
+    }
+    leftCurve = cleaner.viewToFrame(leftCurve);
+    rightCurve = cleaner.viewToFrame(rightCurve);
+    std::vector<std::vector<cv::Point> > curves(2);
+    for (int i = 0; i <= samples; ++i) {
+        curves[0].push_back(cv::Point(cvRound(leftCurve[i].x), \
+                                      cvRound(leftCurve[i].y)));
+        curves[1].push_back(cv::Point(cvRound(rightCurve[i].x), \
+                                      cvRound(rightCurve[i].y)));
+    }
+    cv::polylines(black_img, curves, false, cv::Scalar(0, 0, 255), 3, \
+                  cv::LINE_AA);
+    leftLine = std::make_pair(cv::Point2d(leftCurve.back()), \
+                              cv::Point2d(leftCurve.front()));
+    rightLine = std::make_pair(cv::Point2d(rightCurve.back()), \
+                               cv::Point2d(rightCurve.front()));
+    lap(tick, times.hough);
+
+    polygon[0] = curves[0].front();
+    polygon[1] = curves[1].front();
+    polygon[2] = curves[1].back();
+    polygon[3] = curves[0].back();
+    return polygon;
+}
+
+void LaneStream::prepareBirdsEye() {
+    std::vector<cv::Point2f> roadQuad;
+    if (!settings.birdsEye.empty()) {
+        for (auto& corner : settings.birdsEye) {
+            roadQuad.push_back(cv::Point2f( \
+                static_cast<float>(corner.x * procSize.width), \
+                static_cast<float>(corner.y * procSize.height)));
+        }
+    } else {
+        for (auto& corner : fullGeometry.roiPolygon(procSize))
+            roadQuad.push_back(cv::Point2f(corner));
+    }
+    double sx = static_cast<double>(procSize.width) / \
+                settings.calibrationSize.width;
+    double sy = static_cast<double>(procSize.height) / \
+                settings.calibrationSize.height;
+    cleaner.setBirdsEye(roadQuad, cv::Size( \
+        std::max(16, cvRound(settings.viewSize.width * sx)), \
+        std::max(16, cvRound(settings.viewSize.height * sy))));
+    fitter.reset();
+}
+
+void LaneStream::maskFrame(const cv::Mat& procFrame, bool smoothing, \
+                           const cv::Mat& roiMask, cv::Mat& lanesMask, \
+                           cv::Mat& interestLanes, int64& tick) {
+    cleaner.imgUndistort(procFrame);
+    cv::Mat blurImg = smoothing ? cleaner.imgSmoothen() : \
+                                  cleaner.getUndistorted();
+    lap(tick, times.prepare);
+
+    /***************************************************************
+    *
+    *    After pre-processing we mask the white and yellow lanes, and
+    *    keep those within the region of interest apart from the
+    *    horizon, trees and other details on the sides of the road,
+    *    in one fused pass over all the rows without any L*a*b image
+    *    or separate white and yellow masks
+    *
+    ****************************************************************/
+
+    thresholder.maskRows(blurImg, roiMask, lanesMask, interestLanes);
+    lap(tick, times.threshold);
+}
+
+void LaneStream::maskBands(const cv::Mat& procFrame, bool smoothing, \
+                           const cv::Mat& roiMask, cv::Mat& lanesMask, \
+                           cv::Mat& interestLanes) {
+    cleaner.prepareMaps(procFrame.size());
+    lanesMask.create(procFrame.size(), CV_8U);
+    interestLanes.create(procFrame.size(), CV_8U);
+    int rows = settings.bandRows > 0 ? settings.bandRows : \
+                                       cacheBandRows(procFrame.cols);
+    int bands = (procFrame.rows + rows - 1) / rows;
+    cv::parallel_for_(cv::Range(0, bands), BandMasker(cleaner, thresholder, \
+                      procFrame, roiMask, lanesMask, interestLanes, rows, \
+                      smoothing));
+}
+
+/***
+*@brief  : The maskPlanes() function undistorts the chroma plane with the
+*          camera matrix of its half resolution and blurs it with about half
+*          the kernel, so that it stays aligned with the luminance plane
+*****/
+void LaneStream::maskPlanes(const cv::Mat& luma, const cv::Mat& chroma, \
+                            bool smoothing, const cv::Mat& roiMask, \
+                            cv::Mat& lanesMask, cv::Mat& interestLanes, \
+                            int64& tick) {
+    if (chromaSize != chroma.size()) {
+        chromaSize = chroma.size();
+        chromaCleaner = Cleaner(fullGeometry.cameraMatrix(settings.camParams, \
+                                                          chromaSize), \
+                                settings.distCoeffs, \
+                                settings.gaussKernel / 2 | 1);
+    }
+    cleaner.imgUndistort(luma);
+    chromaCleaner.imgUndistort(chroma);
+    cv::Mat blurLuma = cleaner.getUndistorted();
+    cv::Mat blurChroma = chromaCleaner.getUndistorted();
+    if (smoothing) {
+        blurLuma = cleaner.imgSmoothen();
+        if (chromaCleaner.kernel() >= 3)
+            blurChroma = chromaCleaner.imgSmoothen();
+    }
+    lap(tick, times.prepare);
+
+    thresholder.maskNv12(blurLuma, blurChroma, roiMask, lanesMask, \
+                         interestLanes);
+    lap(tick, times.threshold);
+}
+
+LaneResult LaneStream::reuse(const cv::Mat& frame) {
+    if (procSize.area() == 0)
+        procSize = fullGeometry.downscale(frame).size();
+    return finish(historicLane, STATUS_REUSED, frame.size());
+}
+
+LaneResult LaneStream::extrapolate(const cv::Mat& frame) {
+    if (procSize.area() == 0)
+        procSize = fullGeometry.downscale(frame).size();
+    // Every other frame is skipped, so the two detections are usually two
+    // frames apart; without their frame numbers one frame is assumed
+    long gap = 1, ahead = 1;
+    if (olderFrame > 0 && historicFrame > olderFrame) {
+        gap = historicFrame - olderFrame;
+        ahead = counter - historicFrame;
+    }
+    return finish(RateController::extrapolateLane(olderLane, historicLane, \
+                                                  gap, ahead), \
+                  STATUS_EXTRAPOLATED, frame.size());
+}
+
+/*********************************************************************
+*
+*  Now we extrapolate our polygon to fill a desired area on screen
+*  and make the turn prediction from the slopes of its sides
+*
+*********************************************************************/
+
+LaneResult LaneStream::finish(std::vector<cv::Point> polyRegionVertices, \
+                              unsigned status, cv::Size frameSize) {
+    auto newSlopeLeft = static_cast<float>(polyRegionVertices.at(0).y - \
+                                           polyRegionVertices.at(3).y) /
+                        static_cast<float>(polyRegionVertices.at(0).x - \
+                                           polyRegionVertices.at(3).x);
+
+    auto newSlopeRight = static_cast<float>(polyRegionVertices.at(1).y - \
+                                            polyRegionVertices.at(2).y) /
+                         static_cast<float>(polyRegionVertices.at(1).x - \
+                                            polyRegionVertices.at(2).x);
+
+    auto leftIntercept = static_cast<float>(polyRegionVertices.at(0).y) - \
+                         static_cast<float>(newSlopeLeft) * \
+                         static_cast<float>(polyRegionVertices.at(0).x);
+
+    auto rightIntercept = static_cast<float>(polyRegionVertices.at(1).y) - \
+                          (static_cast<float>(newSlopeRight) * \
+                           static_cast<float>(polyRegionVertices.at(1).x));
+
+    int horizon = fullGeometry.horizonRow(procSize);
+    polyRegionVertices.at(0).x = static_cast<double>((horizon - \
+                                 leftIntercept) / newSlopeLeft);
+    polyRegionVertices.at(0).y = horizon;
+    polyRegionVertices.at(1).x = static_cast<double>((horizon - \
+                                 rightIntercept) / newSlopeRight);
+    polyRegionVertices.at(1).y = horizon;
+
+    // The lane geometry is mapped back to the full resolution frame
+    LaneResult result;
+    result.frameIndex = counter - 1;
+    result.status = status;
+    result.polygon = fullGeometry.toFrame(polyRegionVertices, procSize, \
+                                          frameSize);
+    result.leftLine = std::make_pair( \
+            fullGeometry.toFrame(leftLine.first, procSize, frameSize), \
+            fullGeometry.toFrame(leftLine.second, procSize, frameSize));
+    result.rightLine = std::make_pair( \
+            fullGeometry.toFrame(rightLine.first, procSize, frameSize), \
+            fullGeometry.toFrame(rightLine.second, procSize, frameSize));
+    result.slopeLeft = newSlopeLeft;
+    result.slopeRight = newSlopeRight;
+
+    double deviationLeft = std::abs(newSlopeLeft - 1);
+    double deviationRight = std::abs(newSlopeRight - 1);
+    if (deviationRight > deviationLeft) {
+        result.turn = TURN_LEFT;
+    } else if (deviationRight < deviationLeft) {
+        result.turn = TURN_RIGHT;
+    }
+
+    counter++;
+    return result;
+}
+
+void LaneStream::annotate(cv::Mat& frame, const LaneResult& result) {
+    cv::fillConvexPoly(frame, result.polygon, cv::Scalar(0, 255, 0), \
+                       CV_AA, 0);
+    if (result.turn == TURN_LEFT) {
+        cv::putText(frame, "Left turn ahead", cv::Point(30, 30),
+                    cv::FONT_HERSHEY_COMPLEX_SMALL, 0.8, \
+                    cv::Scalar(200, 200, 250), 1, CV_AA);
+    } else if (result.turn == TURN_RIGHT) {
+        cv::putText(frame, "Right turn ahead", cv::Point(30, 30),
+                    cv::FONT_HERSHEY_COMPLEX_SMALL, 0.8, \
+                    cv::Scalar(200, 200, 250), 1, CV_AA);
+    }
+}
@@ -0,0 +1,84 @@
+/************************************************************************************************
+* @file      : Detection parameter autotuning tool
+* @author    : Arun Kumar Devarajulu
+* @brief     : The lane-tune tool searches the detection settings which keep up with a target frame
+*              rate on this machine on the clips of a regression suite and writes the most accurate
+*              of them, with the whole Pareto front, to a file which shell-app --config loads.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include <string>
+#include <vector>
+#include <iostream>
+#include "Arguments.hpp"
+#include "LaneRegression.hpp"
+#include "LaneTuner.hpp"
+
+int main(int argc, char *argv[]) {
+    Arguments args(argc, argv);
+    if (args.positional().empty()) {
+        std::cout << "Usage: lane-tune <suite.yml> [--target-fps=30] "
+                     "[--output=lanes_tuned.yml] [--trials=48] [--frames=60] "
+                     "[--seed=1] [--threads=<count>]" << std::endl;
+        return -1;
+    }
+
+    std::string error;
+    std::vector<LaneRegression::Clip> clips = \
+        LaneRegression::loadSuite(args.positional().at(0), error);
+    if (clips.empty()) {
+        std::cout << "Error: " << error << std::endl;
+        return -1;
+    }
+    if (args.has("threads"))
+        cv::setNumThreads(args.getInt("threads", 1));
+
+    LaneTuner::Options options;
+    options.targetFps = args.getDouble("target-fps", 30);
+    options.trials = args.getInt("trials", 48);
+    options.framesPerClip = args.getInt("frames", 60);
+    options.seed = static_cast<unsigned>(args.getInt("seed", 1));
+    LaneTuner tuner(clips, options);
+    if (tuner.clipCount() == 0) {
+        std::cout << "Error: the suite has no synthetic clip and no clip "
+                     "with golden results, record them with lane-regress "
+                     "first" << std::endl;
+        return -1;
+    }
+
+    std::vector<LaneTuner::Candidate> front = \
+        LaneTuner::paretoFront(tuner.search());
+    LaneTuner::Candidate chosen = LaneTuner::choose(front, options.targetFps);
+    if (chosen.fps < options.targetFps) {
+        std::cout << "No setting reaches " << options.targetFps \
+                  << " fps, keeping the fastest" << std::endl;
+    }
+    std::string output = args.getString("output", "lanes_tuned.yml");
+    if (!LaneTuner::write(output, chosen, front, options.targetFps)) {
+        std::cout << "Error writing " << output << std::endl;
+        return -1;
+    }
+    std::cout << front.size() << " settings on the Pareto front, chosen " \
+              << chosen.fps << " fps with " << chosen.error \
+              << " px mean error, written to " << output << std::endl;
+    return 0;
+}
@@ -0,0 +1,294 @@
+/************************************************************************************************
+* @file      : Detection parameter autotuner
+* @author    : Arun Kumar Devarajulu
+* @brief     : Implementation of the LaneTuner class, a random search with a local refinement of the
+*              Pareto front of frame rate against deviation from the golden lanes.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "LaneTuner.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <boost/filesystem.hpp>
+#include "LanePipeline.hpp"
+
+namespace {
+// Values of every knob, the compiled-in defaults first
+const double kScales[] = {1.0, 0.75, 0.5, 0.375, 0.25};
+const int kKernels[] = {5, 3, 0};
+const double kCanny[][2] = {{15, 45}, {25, 75}, {40, 120}};
+const double kPolygonCanny[][2] = {{70, 210}, {50, 150}};
+const double kRhos[] = {1, 2, 3};
+const double kThetas[] = {1, 1.5, 2};
+const int kThresholds[] = {10, 15, 25, 40};
+// Number of values of every knob, in the order of Candidate::levels
+const int kLevels[LaneTuner::kKnobs] = {5, 3, 3, 2, 3, 3, 4};
+// Rows sampled along every polygon edge against the true lanes
+const int kTruthRows = 16;
+// Distance, as a fraction of the frame width, of a missed lane
+const double kMissFraction = 0.25;
+
+/***
+*@brief  : Writes the chain settings of a configuration with the keys which
+*          LaneConfig::read takes
+*****/
+void writeSettings(cv::FileStorage& file, const LaneConfig& config) {
+    file << "process_scale" << config.processScale;
+    file << "gauss_kernel" << config.gaussKernel;
+    file << "canny" << "[" << config.cannyLow << config.cannyHigh << "]";
+    file << "polygon_canny" << "[" << config.polygonCannyLow \
+         << config.polygonCannyHigh << "]";
+    file << "hough_rho" << config.houghRho;
+    file << "hough_theta" << config.houghTheta * 180 / CV_PI;
+    file << "hough_threshold" << config.houghThreshold;
+}
+
+bool sameLevels(const LaneTuner::Candidate& a, const LaneTuner::Candidate& b) {
+    return std::equal(a.levels, a.levels + LaneTuner::kKnobs, b.levels);
+}
+}  // namespace
+
+void LaneTuner::Candidate::apply(LaneConfig& config) const {
+    config.processScale = kScales[levels[0]];
+    config.gaussKernel = kKernels[levels[1]];
+    config.cannyLow = kCanny[levels[2]][0];
+    config.cannyHigh = kCanny[levels[2]][1];
+    config.polygonCannyLow = kPolygonCanny[levels[3]][0];
+    config.polygonCannyHigh = kPolygonCanny[levels[3]][1];
+    config.houghRho = kRhos[levels[4]];
+    config.houghTheta = kThetas[levels[5]] * CV_PI / 180;
+    config.houghThreshold = kThresholds[levels[6]];
+}
+
+LaneTuner::LaneTuner(const std::vector<LaneRegression::Clip>& clips, \
+                     const Options& options) : settings(options) {
+    // Synthetic clips know their true lanes. Recorded clips only have the
+    // golden lanes of the default settings, without them there is nothing
+    // to measure the error against
+    for (const LaneRegression::Clip& clip : clips) {
+        if (clip.synthetic || boost::filesystem::exists(clip.golden))
+            suite.push_back(clip);
+    }
+}
+
+void LaneTuner::evaluate(Candidate& candidate) const {
+    double seconds = 0, error = 0;
+    candidate.frames = 0;
+    candidate.mismatched = 0;
+    candidate.truthFrames = 0;
+    for (LaneRegression::Clip clip : suite) {
+        candidate.apply(clip.config);
+        if (clip.frames <= 0 || clip.frames > settings.framesPerClip)
+            clip.frames = settings.framesPerClip;
+        if (clip.synthetic) {
+            scoreTruth(clip, candidate, seconds, error);
+            continue;
+        }
+        LaneRegression::Report report = LaneRegression::run(clip, false);
+        if (report.verdict != LaneRegression::PASSED && \
+            report.verdict != LaneRegression::FAILED)
+            continue;
+        seconds += report.seconds;
+        error += report.meanPolygonDelta * report.frames * 1280 / \
+                 std::max(1, report.frameSize.width);
+        candidate.frames += report.frames;
+        candidate.mismatched += report.mismatched;
+    }
+    candidate.fps = seconds > 0 ? candidate.frames / seconds : 0;
+    candidate.error = candidate.frames > 0 ? error / candidate.frames : \
+                      std::numeric_limits<double>::infinity();
+}
+
+void LaneTuner::scoreTruth(const LaneRegression::Clip& clip, \
+                           Candidate& candidate, double& seconds, \
+                           double& error) const {
+    SceneSource source(clip.scene, clip.frames, clip.fps);
+    LanePipeline::Options options;
+    options.config = clip.config;
+    LanePipeline pipeline(options);
+    const int width = std::max(1, source.frameSize().width);
+    const double cap = kMissFraction * width;
+    cv::Mat frame;
+    while (source.read(frame)) {
+        int64 start = cv::getTickCount();
+        LaneResult result = pipeline.process(LanePipeline::view(frame));
+        seconds += (cv::getTickCount() - start) / cv::getTickFrequency();
+        double distance = truthError(result, source.truth(), cap);
+        if (distance >= cap)
+            candidate.mismatched++;
+        error += distance * 1280 / width;
+        candidate.frames++;
+        candidate.truthFrames++;
+    }
+}
+
+/***
+*@brief  : The truthError() function follows the left polygon edge from
+*          vertex 0 down to vertex 3 and the right one from vertex 1 down to
+*          vertex 2. Rows where the truth has no lane are not sampled.
+*****/
+double LaneTuner::truthError(const LaneResult& result, \
+                             const SceneTruth& truth, double cap) {
+    if (result.polygon.size() != 4)
+        return cap;
+    double sum = 0;
+    int samples = 0;
+    for (int side = 0; side < 2; side++) {
+        const std::vector<cv::Point2d>& lane = side == 0 ? truth.left : \
+                                                           truth.right;
+        cv::Point2d top(result.polygon[side]);
+        cv::Point2d bottom(result.polygon[3 - side]);
+        if (bottom.y <= top.y)
+            continue;
+        for (int i = 0; i < kTruthRows; i++) {
+            double part = (i + 0.5) / kTruthRows;
+            double row = top.y + part * (bottom.y - top.y);
+            double expected = SceneTruth::xAt(lane, row);
+            if (std::isnan(expected))
+                continue;
+            double column = top.x + part * (bottom.x - top.x);
+            sum += std::min(cap, std::abs(column - expected));
+            samples++;
+        }
+    }
+    return samples > 0 ? sum / samples : cap;
+}
+
+std::vector<LaneTuner::Candidate> LaneTuner::search() const {
+    std::vector<Candidate> measured;
+    std::ostream& log = *settings.log;
+    auto measure = [&](const Candidate& candidate) {
+        for (const Candidate& known : measured) {
+            if (sameLevels(known, candidate))
+                return;
+        }
+        Candidate result = candidate;
+        evaluate(result);
+        LaneConfig config;
+        result.apply(config);
+        log << std::fixed << std::setprecision(2) << "scale " \
+            << config.processScale << ", kernel " << config.gaussKernel \
+            << ", canny " << config.cannyLow << "/" << config.cannyHigh \
+            << ", polygon canny " << config.polygonCannyLow << "/" \
+            << config.polygonCannyHigh << ", hough " << config.houghRho \
+            << " px " << config.houghTheta * 180 / CV_PI << " deg " \
+            << config.houghThreshold << ": " << result.fps << " fps, " \
+            << result.error << " px" << std::endl;
+        log.unsetf(std::ios::floatfield);
+        measured.push_back(result);
+    };
+
+    measure(Candidate());
+    cv::RNG rng(settings.seed);
+    for (int trial = 0; trial < settings.trials; trial++) {
+        Candidate candidate;
+        for (int knob = 0; knob < kKnobs; knob++)
+            candidate.levels[knob] = rng.uniform(0, kLevels[knob]);
+        measure(candidate);
+    }
+
+    // Every knob of the front is moved one step either way
+    std::vector<Candidate> front = paretoFront(measured);
+    for (const Candidate& best : front) {
+        for (int knob = 0; knob < kKnobs; knob++) {
+            for (int step = -1; step <= 1; step += 2) {
+                Candidate neighbour = best;
+                neighbour.levels[knob] += step;
+                if (neighbour.levels[knob] >= 0 && \
+                    neighbour.levels[knob] < kLevels[knob])
+                    measure(neighbour);
+            }
+        }
+    }
+    return measured;
+}
+
+std::vector<LaneTuner::Candidate> LaneTuner::paretoFront( \
+        const std::vector<Candidate>& candidates) {
+    std::vector<Candidate> front;
+    for (const Candidate& candidate : candidates) {
+        bool beaten = candidate.frames == 0;
+        for (const Candidate& other : candidates) {
+            if (other.fps >= candidate.fps && other.error <= candidate.error \
+                && (other.fps > candidate.fps || other.error < candidate.error))
+                beaten = true;
+        }
+        if (!beaten)
+            front.push_back(candidate);
+    }
+    std::sort(front.begin(), front.end(), \
+              [](const Candidate& a, const Candidate& b) {
+                  return a.fps > b.fps;
+              });
+    return front;
+}
+
+LaneTuner::Candidate LaneTuner::choose(const std::vector<Candidate>& front, \
+                                       double targetFps) {
+    const Candidate* chosen = nullptr;
+    for (const Candidate& candidate : front) {
+        if (candidate.fps >= targetFps && \
+            (!chosen || candidate.error < chosen->error))
+            chosen = &candidate;
+    }
+    if (!chosen && !front.empty())
+        chosen = &front.front();
+    return chosen ? *chosen : Candidate();
+}
+
+bool LaneTuner::write(const std::string& path, const Candidate& chosen, \
+                      const std::vector<Candidate>& front, double targetFps) {
+    cv::FileStorage file(path, cv::FileStorage::WRITE);
+    if (!file.isOpened())
+        return false;
+    file.writeComment("Detection settings chosen by lane-tune on " + \
+                      std::to_string(cv::getNumberOfCPUs()) + " cores");
+    file << "target_fps" << targetFps;
+    file << "measured_fps" << chosen.fps;
+    file.writeComment("mean_error is in pixels of a 1280 pixel wide frame, "
+                      "the distance of the polygon edges from the true lanes "
+                      "on truth_frames synthetic frames and the move of the "
+                      "polygon vertices from the golden results, which are "
+                      "the output of the default settings, on golden_frames "
+                      "recorded frames without a truth");
+    file << "mean_error" << chosen.error;
+    file << "truth_frames" << static_cast<int>(chosen.truthFrames);
+    file << "golden_frames" << static_cast<int>(chosen.frames - \
+                                                chosen.truthFrames);
+    LaneConfig config;
+    chosen.apply(config);
+    writeSettings(file, config);
+
+    // The whole front, for picking another trade-off by hand
+    file << "pareto" << "[";
+    for (const Candidate& candidate : front) {
+        file << "{" << "fps" << candidate.fps << "error" << candidate.error;
+        candidate.apply(config);
+        writeSettings(file, config);
+        file << "}";
+    }
+    file << "]";
+    file.release();
+    return true;
+}
@@ -43,14 +43,17 @@ typedef std::vector<cv::Vec2f> hType;
 *****/
 
 void LanesMarker::lanesSegregator(hType hLines) {
+    // The lanes of the previous frame are discarded
+    lLane.clear();
+    rLane.clear();
     for (auto& item : hLines) {
         rho = item[0], theta = item[1];
         a = std::cos(theta), b = std::sin(theta);
         x0 = a * rho, y0 = b * rho;
-        pt1.x = cvRound(x0 + 1500 * (-b));
-        pt1.y = cvRound(y0 + 1500 * (a));
-        pt2.x = cvRound(x0 - 1500 * (-b));
-        pt2.y = cvRound(y0 - 1500 * (a));
+        pt1.x = cvRound(x0 + lineExtent * (-b));
+        pt1.y = cvRound(y0 + lineExtent * (a));
+        pt2.x = cvRound(x0 - lineExtent * (-b));
+        pt2.y = cvRound(y0 - lineExtent * (a));
 
         slope = ((pt2.y - pt1.y) / (pt2.x - pt1.x));
         // Creation of left lanes set
@@ -73,6 +76,7 @@ void LanesMarker::lanesSegregator(hType hLines) {
 ******/
 
 pointsPair LanesMarker::leftLanesAverage() {
+    pt1xLeft = pt1yLeft = pt2xLeft = pt2yLeft = 0;
     for (auto& item : lLane) {
         cv::Point2d V1;
         V1 = item.first;
@@ -102,6 +106,7 @@ pointsPair LanesMarker::leftLanesAverage() {
 *          belonging to the right lane
 ******/
 pointsPair LanesMarker::rightLanesAverage() {
+    pt1xRight = pt1yRight = pt2xRight = pt2yRight = 0;
     for (auto& item : rLane) {
         cv::Point2d V1;
         V1 = item.first;
@@ -0,0 +1,78 @@
+/************************************************************************************************
+* @file      : Converter from binary lane results to CSV
+* @author    : Arun Kumar Devarajulu
+* @brief     : The lanes-to-csv tool memory-maps a binary lane results file written with
+*              shell-app --binary and converts all or a range of its frames to the
+*              same CSV layout as shell-app --results. Usage:
+*                lanes-to-csv <results.lres> [output.csv] [--first=N] [--last=N]
+*              When no output file is given the CSV is written next to the input.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include <string>
+#include <iostream>
+#include "Arguments.hpp"
+#include "LaneRecordReader.hpp"
+#include "ResultSink.hpp"
+
+int main(int argc, char *argv[]) {
+    Arguments args(argc, argv);
+    if (args.positional().empty()) {
+        std::cout << "Usage: lanes-to-csv <results.lres> [output.csv] "
+                     "[--first=N] [--last=N]" << std::endl;
+        return -1;
+    }
+
+    std::string inputAddress = args.positional().at(0);
+    std::string outputAddress = args.positional().size() > 1 ? \
+                                args.positional().at(1) : \
+                                inputAddress + ".csv";
+
+    LaneRecordReader reader;
+    if (!reader.open(inputAddress)) {
+        std::cout << "Error: " << reader.error() << std::endl;
+        return -1;
+    }
+
+    const LaneFileHeader& header = reader.header();
+    std::cout << inputAddress << ": " << reader.size() << " frames of "
+              << header.width << "x" << header.height << ", calibration "
+              << std::hex << header.calibrationHash << std::dec << std::endl;
+
+    // The frame range is looked up through the index, not scanned
+    size_t first = 0, last = reader.size();
+    if (args.has("first")) {
+        const LaneRecord *record = reader.find(args.getInt("first", 0));
+        first = record ? static_cast<size_t>(record - &reader.at(0)) : last;
+    }
+    if (args.has("last")) {
+        const LaneRecord *record = reader.find(args.getInt("last", 0));
+        last = record ? static_cast<size_t>(record - &reader.at(0)) + 1 : last;
+    }
+
+    CsvSink csv(outputAddress);
+    for (size_t i = first; i < last; i++) {
+        csv.write(cv::Mat(), BinarySink::toResult(reader.at(i)));
+    }
+    csv.close();
+    return 0;
+}
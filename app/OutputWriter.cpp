@@ -0,0 +1,135 @@
+/************************************************************************************************
+* @file      : Implementation for OutputWriter class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The OutputWriter class runs the result sinks on their own thread
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "OutputWriter.hpp"
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+void OutputWriter::addSink(std::unique_ptr<ResultSink> sink) {
+    imagesNeeded = imagesNeeded || sink->needsFrame();
+    sinks.push_back(std::move(sink));
+}
+
+bool OutputWriter::needsFrame() const {
+    return imagesNeeded;
+}
+
+/***
+*@brief  : The push() function starts the writer thread on the first call and
+*          waits while the queue is full. The image is dropped right away when
+*          no sink needs it, and the whole output once the writer is closed.
+*@params : frame is the annotated frame
+*@params : result is the lane result of the frame
+*****/
+void OutputWriter::push(const cv::Mat& frame, const LaneResult& result) {
+    if (sinks.empty())
+        return;
+    std::unique_lock<std::mutex> lock(queueMutex);
+    if (!worker.joinable() && !stopping) {
+        running = true;
+        worker = std::thread(&OutputWriter::run, this);
+    }
+    notFull.wait(lock, [this] {
+        return stopping || !running || queue.size() < maxQueue;
+    });
+    if (stopping || !running) {
+        std::cerr << "Warning: output of frame " << result.frameIndex \
+                  << " pushed after the writer was closed is dropped" \
+                  << std::endl;
+        return;
+    }
+    queue.emplace_back(imagesNeeded ? frame : cv::Mat(), result);
+    notEmpty.notify_one();
+}
+
+void OutputWriter::start() {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    if (!sinks.empty() && !worker.joinable() && !stopping) {
+        running = true;
+        worker = std::thread(&OutputWriter::run, this);
+    }
+}
+
+void OutputWriter::close() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    notEmpty.notify_one();
+    notFull.notify_all();
+    if (worker.joinable())
+        worker.join();
+    for (auto& sink : sinks) {
+        sink->close();
+    }
+}
+
+std::vector<long long> OutputWriter::positions() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    written.wait(lock, [this] {
+        return !running || (queue.empty() && !writing);
+    });
+    std::vector<long long> bytes;
+    for (auto& sink : sinks) {
+        bytes.push_back(sink->position());
+    }
+    return bytes;
+}
+
+/***
+*@brief  : The run() function takes the outputs out of the queue in order and
+*          passes them to every sink. The sinks run without holding the lock,
+*          so the detection thread only waits when the queue is full.
+*****/
+void OutputWriter::run() {
+    while (true) {
+        std::pair<cv::Mat, LaneResult> item;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            notEmpty.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                running = false;
+                notFull.notify_all();
+                written.notify_all();
+                return;
+            }
+            item = std::move(queue.front());
+            queue.pop_front();
+            writing = true;
+        }
+        notFull.notify_one();
+        for (auto& sink : sinks) {
+            sink->write(item.first, item.second);
+        }
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            writing = false;
+        }
+        written.notify_all();
+    }
+}
@@ -0,0 +1,150 @@
+/************************************************************************************************
+* @file      : Implementation of the PreviewRenderer class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The PreviewRenderer class keeps a single slot for the next frame to show. The detection
+*              thread replaces the frame in the slot without waiting, and the renderer thread converts,
+*              downscales and annotates it and runs the HighGUI event loop.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <opencv2/highgui/highgui.hpp>
+#include "PreviewRenderer.hpp"
+#include "LanePipeline.hpp"
+
+namespace {
+/***
+*@brief  : The lanes of a frame in the co-ordinates of its preview
+*****/
+LaneResult scaled(const LaneResult& result, double scale) {
+    LaneResult preview = result;
+    for (cv::Point& vertex : preview.polygon) {
+        vertex = cv::Point(cvRound(vertex.x * scale), \
+                           cvRound(vertex.y * scale));
+    }
+    return preview;
+}
+}  // namespace
+
+PreviewRenderer::PreviewRenderer(const Options& options) : options(options) {
+    worker = std::thread(&PreviewRenderer::run, this);
+}
+
+/***
+*@brief  : The offer() function only tries the lock, since the renderer
+*          holds it just to swap the slot, and clones the debug images,
+*          which the stream builds anew for every frame
+*****/
+bool PreviewRenderer::offer(const cv::Mat& frame, int format, \
+                            const LaneResult& result, \
+                            const LaneStream *stream) {
+    int64 now = cv::getTickCount();
+    if (options.fps > 0 && lastOffer != 0 && \
+        now - lastOffer < cv::getTickFrequency() / options.fps)
+        return false;
+    std::unique_lock<std::mutex> lock(slotMutex, std::try_to_lock);
+    if (!lock.owns_lock() || stopping)
+        return false;
+    if (pending)
+        dropped++;
+    this->frame = frame;
+    this->format = format;
+    this->result = result;
+    if (options.debug && stream) {
+        mask = stream->lanesMask().clone();
+        edges = stream->edges().clone();
+        lines = stream->houghLines().clone();
+    }
+    pending = true;
+    lastOffer = now;
+    ready.notify_one();
+    return true;
+}
+
+void PreviewRenderer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(slotMutex);
+        stopping = true;
+    }
+    ready.notify_one();
+    if (worker.joinable())
+        worker.join();
+}
+
+void PreviewRenderer::report(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(slotMutex);
+    out << "Preview: " << shown << " frames shown, " << dropped \
+        << " dropped" << std::endl;
+}
+
+/***
+*@brief  : The run() function owns every window, so all the HighGUI calls
+*          are made on the renderer thread. The event loop keeps running
+*          between frames so that the windows stay responsive.
+*****/
+void PreviewRenderer::run() {
+    while (true) {
+        cv::Mat image, maskImage, edgesImage, linesImage;
+        int imageFormat = 0;
+        LaneResult lanes;
+        {
+            std::unique_lock<std::mutex> lock(slotMutex);
+            ready.wait_for(lock, std::chrono::milliseconds(30), \
+                           [this] { return pending || stopping; });
+            if (stopping)
+                break;
+            if (pending) {
+                std::swap(image, frame);
+                std::swap(maskImage, mask);
+                std::swap(edgesImage, edges);
+                std::swap(linesImage, lines);
+                imageFormat = format;
+                lanes = result;
+                pending = false;
+                shown++;
+            }
+        }
+        if (!image.empty()) {
+            cv::Mat bgr = LanePipeline::bgr(image, imageFormat);
+            double scale = options.width > 0 && options.width < bgr.cols ? \
+                           static_cast<double>(options.width) / bgr.cols : 1;
+            cv::Mat preview;
+            if (scale < 1) {
+                cv::resize(bgr, preview, cv::Size(), scale, scale, \
+                           cv::INTER_AREA);
+            } else {
+                preview = bgr.clone();
+            }
+            LaneStream::annotate(preview, scaled(lanes, scale));
+            if (!maskImage.empty()) {
+                cv::imshow("Lanes Mask", maskImage);
+                cv::imshow("Canny Output", edgesImage);
+                cv::imshow("Hough Output", linesImage);
+            }
+            cv::imshow("Final Lane Detection", preview);
+        }
+        if (static_cast<char>(cv::waitKey(1)) == 27)
+            escaped = true;
+    }
+    cv::destroyAllWindows();
+}
@@ -0,0 +1,154 @@
+/************************************************************************************************
+* @file      : Implementation for RateController class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The RateController class trades detection quality for keeping up with
+*              the frame rate of a live source
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "RateController.hpp"
+#include <vector>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+/***
+*@brief  : The constructor derives the per-frame time budget from the frame rate.
+*          Sources which do not report a frame rate fall back to 30 fps.
+*@params : fps is the frame rate of the source
+*@params : log is the stream on which the level transitions are written
+*@params : maxLevel is the lowest quality level the controller may use
+*****/
+RateController::RateController(double fps, std::ostream& log, int maxLevel) : \
+    logStream(log), budget(1.0 / (fps > 0 ? fps : 30.0)), \
+    lowestLevel(std::min(4, std::max(0, maxLevel))), \
+    levelSeconds(5, 0.0), levelFrames(5, 0) {}
+
+/***
+*@brief  : The update() function keeps an exponential moving average of the frame
+*          time. The level goes down after a few frames over budget and comes
+*          back up only after a much longer run of frames with clear headroom,
+*          so that the controller does not oscillate between two levels. After
+*          each transition the controller waits for the average to settle.
+*@params : seconds is the time spent on the frame
+*****/
+void RateController::update(double seconds) {
+    frames++;
+    levelSeconds[currentLevel] += seconds;
+    levelFrames[currentLevel]++;
+    average = (frames == 1) ? seconds : \
+              (1 - alpha) * average + alpha * seconds;
+
+    if (cooldown > 0) {
+        cooldown--;
+        return;
+    }
+
+    slowFrames = (average > budget) ? slowFrames + 1 : 0;
+    fastFrames = (average < headroom * budget) ? fastFrames + 1 : 0;
+
+    if (slowFrames >= patience && currentLevel < lowestLevel) {
+        changeLevel(currentLevel + 1);
+    } else if (fastFrames >= recovery && currentLevel > 0) {
+        changeLevel(currentLevel - 1);
+    }
+}
+
+/***
+*@brief  : The changeLevel() function formats the transition on its own
+*          stream, so the fixed precision does not stick to the log, which is
+*          usually std::cout
+*****/
+void RateController::changeLevel(int newLevel) {
+    std::ostringstream line;
+    line << "frame " << frames << ": quality level " << currentLevel
+         << " -> " << newLevel << std::fixed << std::setprecision(1)
+         << " (average " << average * 1000 << " ms, budget "
+         << budget * 1000 << " ms)";
+    logStream << line.str() << std::endl;
+    currentLevel = newLevel;
+    slowFrames = 0;
+    fastFrames = 0;
+    cooldown = settle;
+}
+
+/***
+*@brief  : The skipFrame() function alternates between processed and skipped
+*          frames on the lowest quality level
+*@return : true if the frame should use extrapolated lanes
+*****/
+bool RateController::skipFrame() {
+    if (currentLevel < 4) {
+        skipToggle = false;
+        return false;
+    }
+    skipToggle = !skipToggle;
+    return !skipToggle;
+}
+
+/***
+*@brief  : The extrapolateLane() function moves every vertex of the newer polygon
+*          by the displacement per frame between the older and the newer
+*          polygon times the frames ahead, which assumes constant lane motion
+*          over the skipped frames
+*@params : older is the polygon detected before the latest one
+*@params : newer is the latest detected polygon
+*@params : gap is the number of frames from older to newer
+*@params : ahead is the number of frames from newer to the current frame
+*@return : The predicted polygon for the current frame
+*****/
+std::vector<cv::Point> RateController::extrapolateLane( \
+        const std::vector<cv::Point>& older, \
+        const std::vector<cv::Point>& newer, long gap, long ahead) {
+    if (older.size() != newer.size() || gap <= 0)
+        return newer;
+    double scale = static_cast<double>(ahead) / gap;
+    std::vector<cv::Point> predicted;
+    for (size_t i = 0; i < newer.size(); i++) {
+        cv::Point motion = newer[i] - older[i];
+        predicted.push_back(newer[i] + cv::Point(cvRound(motion.x * scale), \
+                                                 cvRound(motion.y * scale)));
+    }
+    return predicted;
+}
+
+void RateController::report(std::ostream& out) const {
+    out << "frames: " << frames << "\n"
+        << "budget_ms: " << budget * 1000 << "\n";
+    for (int i = 0; i <= lowestLevel; i++) {
+        out << "level_" << i << "_frames: " << levelFrames[i] << "\n"
+            << "level_" << i << "_seconds: " << levelSeconds[i] << "\n";
+    }
+    out << "final_level: " << currentLevel << std::endl;
+}
+
+double RateController::scaleFactor() const {
+    return currentLevel >= 1 ? 0.5 : 1.0;
+}
+
+double RateController::houghFactor() const {
+    return currentLevel >= 2 ? 2.0 : 1.0;
+}
+
+bool RateController::smoothing() const {
+    return currentLevel < 3;
+}
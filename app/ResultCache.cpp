@@ -0,0 +1,343 @@
+/************************************************************************************************
+* @file      : Implementation of the ResultCache class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ResultCache class stores every chunk as a raw file of the exact lane values and a
+*              checkpoint of the pipeline state. Both are written under temporary names and renamed, and
+*              the use of a chunk is recorded in the modification time of its files.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include <cstdio>
+#include <ctime>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include "ResultCache.hpp"
+#include "Checkpoint.hpp"
+#include "LaneRecord.hpp"
+
+namespace FS = boost::filesystem;    //! Short form for boost filesystem
+
+namespace {
+const char kChunkMagic[8] = {'L', 'A', 'N', 'E', 'C', 'H', 'K', '1'};
+
+/***
+*@brief  : A cached chunk on disk, as seen by the eviction
+*****/
+struct ChunkFiles {
+    std::vector<FS::path> paths;   // < The lanes and state files
+    uintmax_t bytes = 0;   // < Size of the files
+    std::time_t used = 0;   // < Last use, the latest modification time
+};
+
+/***
+*@brief  : The lanes are kept as doubles, so that a cached frame gives
+*          exactly the values of a processed one
+*****/
+void putResult(std::vector<double>& values, const LaneResult& result) {
+    const double fields[] = {static_cast<double>(result.frameIndex), \
+        result.leftLine.first.x, result.leftLine.first.y, \
+        result.leftLine.second.x, result.leftLine.second.y, \
+        result.rightLine.first.x, result.rightLine.first.y, \
+        result.rightLine.second.x, result.rightLine.second.y, \
+        result.slopeLeft, result.slopeRight, \
+        static_cast<double>(result.turn), \
+        static_cast<double>(result.status), \
+        static_cast<double>(result.polygon.size())};
+    values.insert(values.end(), fields, fields + 14);
+    for (const cv::Point& vertex : result.polygon) {
+        values.push_back(vertex.x);
+        values.push_back(vertex.y);
+    }
+}
+
+bool getResult(const std::vector<double>& values, size_t& at, \
+               LaneResult& result) {
+    if (at + 14 > values.size())
+        return false;
+    const double *field = values.data() + at;
+    result.frameIndex = static_cast<long>(field[0]);
+    result.leftLine.first = cv::Point2d(field[1], field[2]);
+    result.leftLine.second = cv::Point2d(field[3], field[4]);
+    result.rightLine.first = cv::Point2d(field[5], field[6]);
+    result.rightLine.second = cv::Point2d(field[7], field[8]);
+    result.slopeLeft = field[9];
+    result.slopeRight = field[10];
+    result.turn = static_cast<int>(field[11]);
+    result.status = static_cast<unsigned>(field[12]);
+    size_t vertices = static_cast<size_t>(field[13]);
+    at += 14;
+    if (at + 2 * vertices > values.size())
+        return false;
+    result.polygon.clear();
+    for (size_t i = 0; i < vertices; i++, at += 2) {
+        result.polygon.push_back(cv::Point(static_cast<int>(values[at]), \
+                                           static_cast<int>(values[at + 1])));
+    }
+    return true;
+}
+}  // namespace
+
+ResultCache::ResultCache(const std::string& directory, uintmax_t capacity, \
+                         long chunk) : directory(directory), \
+                         capacity(capacity), chunkFrames(std::max(1L, chunk)) {
+    boost::system::error_code failure;
+    FS::create_directories(directory, failure);
+}
+
+/***
+*@brief  : The contentHash() function reads the file in blocks of 1 MB and
+*          adds its size, so that a truncated copy has another hash
+*****/
+bool ResultCache::contentHash(const std::string& path, uint64_t& hash) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open() || !FS::is_regular_file(path))
+        return false;
+    std::vector<char> block(1 << 20);
+    uint64_t size = 0;
+    hash = laneHash(nullptr, 0);
+    while (file) {
+        file.read(block.data(), block.size());
+        std::streamsize count = file.gcount();
+        hash = laneHash(block.data(), static_cast<size_t>(count), hash);
+        size += static_cast<uint64_t>(count);
+    }
+    if (file.bad())
+        return false;
+    hash = laneHash(&size, sizeof(size), hash);
+    return true;
+}
+
+/***
+*@brief  : The key() function also hashes the engine version and the chunk
+*          size, since both change what a cached chunk holds
+*****/
+std::string ResultCache::key(uint64_t content, uint64_t settings, \
+                             int format) const {
+    uint64_t hash = laneHash(&content, sizeof(content));
+    hash = laneHash(&settings, sizeof(settings), hash);
+    hash = laneHash(&format, sizeof(format), hash);
+    hash = laneHash(&kLaneEngineVersion, sizeof(kLaneEngineVersion), hash);
+    int64_t frames = chunkFrames;
+    hash = laneHash(&frames, sizeof(frames), hash);
+    char text[17];
+    std::snprintf(text, sizeof(text), "%016llx", \
+                  static_cast<unsigned long long>(hash));
+    return text;
+}
+
+bool ResultCache::find(const std::string& key, long first, \
+                       std::vector<LaneResult>& results, \
+                       LanePipeline::State& state) {
+    FS::path folder = FS::path(directory) / key;
+    FS::path lanesPath = folder / (std::to_string(first) + ".lanes");
+    FS::path statePath = folder / (std::to_string(first) + ".yml");
+    // The state is written last, so a chunk without it is incomplete
+    if (!FS::exists(statePath) || !FS::exists(lanesPath))
+        return false;
+
+    boost::system::error_code failure;
+    uintmax_t bytes = FS::file_size(lanesPath, failure);
+    std::ifstream file(lanesPath.string(), std::ios::binary);
+    char magic[sizeof(kChunkMagic)];
+    uint64_t count = 0, length = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(&count), sizeof(count));
+    file.read(reinterpret_cast<char *>(&length), sizeof(length));
+    if (!file || !std::equal(magic, magic + sizeof(magic), kChunkMagic) || \
+        failure || count == 0 || \
+        count > static_cast<uint64_t>(chunkFrames) || \
+        bytes != sizeof(magic) + sizeof(count) + sizeof(length) + \
+                 length * sizeof(double))
+        return false;
+    std::vector<double> values(length);
+    file.read(reinterpret_cast<char *>(values.data()), \
+              static_cast<std::streamsize>(length * sizeof(double)));
+    if (!file)
+        return false;
+
+    Checkpoint saved;
+    std::string error;
+    if (!saved.load(statePath.string(), error) || saved.input != key || \
+        saved.frames != first + static_cast<long>(count))
+        return false;
+
+    results.clear();
+    size_t at = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        LaneResult result;
+        if (!getResult(values, at, result))
+            return false;
+        results.push_back(result);
+    }
+    state = saved.pipeline;
+
+    // The modification time is the last use seen by evict()
+    std::time_t now = std::time(nullptr);
+    FS::last_write_time(lanesPath, now, failure);
+    FS::last_write_time(statePath, now, failure);
+    return true;
+}
+
+bool ResultCache::store(const std::string& key, long first, \
+                        const std::vector<LaneResult>& results, \
+                        const LanePipeline::State& state) {
+    if (results.empty() || results.size() > static_cast<size_t>(chunkFrames))
+        return false;
+    FS::path folder = FS::path(directory) / key;
+    boost::system::error_code failure;
+    FS::create_directories(folder, failure);
+    std::string name = std::to_string(first);
+    FS::path lanesPath = folder / (name + ".lanes");
+    FS::path temporary = folder / (name + ".tmp.lanes");
+
+    std::vector<double> values;
+    for (const LaneResult& result : results)
+        putResult(values, result);
+    uint64_t count = results.size(), length = values.size();
+    {
+        std::ofstream file(temporary.string(), std::ios::binary);
+        file.write(kChunkMagic, sizeof(kChunkMagic));
+        file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+        file.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        file.write(reinterpret_cast<const char *>(values.data()), \
+                   static_cast<std::streamsize>(length * sizeof(double)));
+        if (!file)
+            return false;
+    }
+    if (std::rename(temporary.string().c_str(), \
+                    lanesPath.string().c_str()) != 0)
+        return false;
+
+    Checkpoint saved;
+    saved.input = key;
+    saved.frames = first + static_cast<long>(count);
+    saved.pipeline = state;
+    std::string error;
+    return saved.save((folder / (name + ".yml")).string(), error);
+}
+
+void ResultCache::complete(const std::string& key, long frames) {
+    FS::path folder = FS::path(directory) / key;
+    FS::path temporary = folder / "complete.tmp.yml";
+    {
+        cv::FileStorage file(temporary.string(), cv::FileStorage::WRITE);
+        if (!file.isOpened())
+            return;
+        file << "frames" << static_cast<int>(frames);
+    }
+    std::rename(temporary.string().c_str(), \
+                (folder / "complete.yml").string().c_str());
+}
+
+long ResultCache::frames(const std::string& key) const {
+    FS::path folder = FS::path(directory) / key;
+    FS::path completePath = folder / "complete.yml";
+    if (!FS::exists(completePath))
+        return -1;
+    cv::FileStorage file(completePath.string(), cv::FileStorage::READ);
+    if (!file.isOpened() || !file["frames"].isInt())
+        return -1;
+    long total = static_cast<int>(file["frames"]);
+    for (long first = 0; first < total; first += chunkFrames) {
+        std::string name = std::to_string(first);
+        if (!FS::exists(folder / (name + ".lanes")) || \
+            !FS::exists(folder / (name + ".yml")))
+            return -1;
+    }
+    return total;
+}
+
+/***
+*@brief  : The evict() function sorts the chunks of every key by their last
+*          use. A key left without chunks is removed with its record of
+*          completion.
+*****/
+int ResultCache::evict() {
+    boost::system::error_code failure;
+    if (!FS::is_directory(directory, failure))
+        return 0;
+    std::vector<ChunkFiles> chunks;
+    std::vector<FS::path> folders;
+    uintmax_t total = 0;
+    for (FS::directory_iterator key(directory, failure), end; \
+         !failure && key != end; key.increment(failure)) {
+        if (!FS::is_directory(key->path()))
+            continue;
+        folders.push_back(key->path());
+        std::vector<std::pair<std::string, ChunkFiles>> named;
+        for (FS::directory_iterator file(key->path(), failure); \
+             !failure && file != end; file.increment(failure)) {
+            boost::system::error_code unreadable;
+            uintmax_t bytes = FS::file_size(file->path(), unreadable);
+            if (unreadable)
+                continue;
+            total += bytes;
+            std::string stem = file->path().stem().string();
+            if (stem == "complete")
+                continue;
+            auto chunk = std::find_if(named.begin(), named.end(), \
+                [&](const std::pair<std::string, ChunkFiles>& entry) {
+                    return entry.first == stem;
+                });
+            if (chunk == named.end())
+                chunk = named.insert(named.end(), \
+                                     std::make_pair(stem, ChunkFiles()));
+            chunk->second.paths.push_back(file->path());
+            chunk->second.bytes += bytes;
+            chunk->second.used = std::max(chunk->second.used, \
+                FS::last_write_time(file->path(), unreadable));
+        }
+        failure.clear();
+        for (auto& entry : named)
+            chunks.push_back(entry.second);
+    }
+
+    std::sort(chunks.begin(), chunks.end(), \
+              [](const ChunkFiles& a, const ChunkFiles& b) {
+                  return a.used < b.used;
+              });
+    int removed = 0;
+    for (const ChunkFiles& chunk : chunks) {
+        if (total <= capacity)
+            break;
+        for (const FS::path& path : chunk.paths)
+            FS::remove(path, failure);
+        total -= chunk.bytes;
+        removed++;
+    }
+
+    for (const FS::path& folder : folders) {
+        bool empty = true;
+        for (FS::directory_iterator file(folder, failure), end; \
+             !failure && file != end; file.increment(failure)) {
+            if (file->path().stem() != "complete")
+                empty = false;
+        }
+        if (empty)
+            FS::remove_all(folder, failure);
+        failure.clear();
+    }
+    return removed;
+}
@@ -0,0 +1,164 @@
+/************************************************************************************************
+* @file      : Implementation for ResultRing class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ResultRing class passes lane records through POSIX shared memory
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "ResultRing.hpp"
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+
+namespace {
+// How long next() sleeps between two looks at an empty ring
+const std::chrono::microseconds kPollInterval(200);
+}  // namespace
+
+ResultRing::~ResultRing() {
+    finish();
+}
+
+bool ResultRing::create(const std::string& name, uint32_t slots) {
+    if (slots == 0) {
+        lastError = "a result ring needs at least one slot";
+        return false;
+    }
+    if (!segment.create(name, sizeof(ResultRingHeader) + \
+                              sizeof(ResultSlot) * size_t(slots))) {
+        lastError = segment.error();
+        return false;
+    }
+    header = new (segment.data()) ResultRingHeader();
+    std::memcpy(header->magic, kResultRingMagic, sizeof(header->magic));
+    header->version = kRingVersion;
+    header->headerSize = sizeof(ResultRingHeader);
+    header->slotCount = slots;
+    header->recordSize = sizeof(LaneRecord);
+    header->published.store(0, std::memory_order_relaxed);
+    header->closed.store(0, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < slots; ++i) {
+        ResultSlot *slot = new (slotAt(i + 1)) ResultSlot();
+        slot->sequence.store(0, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    writer = true;
+    return true;
+}
+
+void ResultRing::publish(const LaneRecord& record, uint64_t timestampNs) {
+    if (!writer || !header)
+        return;
+    uint64_t sequence = header->published.load(std::memory_order_relaxed) + 1;
+    ResultSlot *slot = slotAt(sequence);
+    slot->sequence.store(kSlotBusy, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot->timestampNs = timestampNs;
+    slot->record = record;
+    slot->sequence.store(sequence, std::memory_order_release);
+    header->published.store(sequence, std::memory_order_release);
+}
+
+void ResultRing::finish() {
+    if (writer && header)
+        header->closed.store(1, std::memory_order_release);
+}
+
+bool ResultRing::attach(const std::string& name) {
+    writer = false;
+    header = nullptr;
+    if (!segment.attach(name)) {
+        lastError = segment.error();
+        return false;
+    }
+    ResultRingHeader *candidate = \
+        static_cast<ResultRingHeader*>(segment.data());
+    if (segment.size() < sizeof(ResultRingHeader) || \
+        std::memcmp(candidate->magic, kResultRingMagic, \
+                    sizeof(candidate->magic)) != 0) {
+        lastError = name + " is not a result ring";
+        return false;
+    }
+    if (candidate->version != kRingVersion || \
+        candidate->headerSize != sizeof(ResultRingHeader) || \
+        candidate->recordSize != sizeof(LaneRecord)) {
+        lastError = name + " has an unsupported result ring version";
+        return false;
+    }
+    if (candidate->slotCount == 0 || \
+        segment.size() < sizeof(ResultRingHeader) + \
+                         sizeof(ResultSlot) * size_t(candidate->slotCount)) {
+        lastError = name + " has a damaged result ring header";
+        return false;
+    }
+    header = candidate;
+    nextSequence = 1;
+    droppedRecords = 0;
+    return true;
+}
+
+bool ResultRing::next(LaneRecord& record, uint64_t& timestampNs, \
+                      double timeoutSeconds) {
+    if (!header)
+        return false;
+    auto deadline = std::chrono::steady_clock::now() + \
+        std::chrono::microseconds(static_cast<int64_t>(timeoutSeconds * 1e6));
+    for (;;) {
+        bool closed = header->closed.load(std::memory_order_acquire) != 0;
+        uint64_t newest = header->published.load(std::memory_order_acquire);
+        if (nextSequence > newest) {
+            if (closed || std::chrono::steady_clock::now() >= deadline)
+                return false;
+            std::this_thread::sleep_for(kPollInterval);
+            continue;
+        }
+        if (newest - nextSequence >= header->slotCount) {
+            uint64_t oldest = newest - header->slotCount + 1;
+            droppedRecords += oldest - nextSequence;
+            nextSequence = oldest;
+        }
+        uint64_t sequence = nextSequence++;
+        ResultSlot *slot = slotAt(sequence);
+        if (slot->sequence.load(std::memory_order_acquire) != sequence) {
+            ++droppedRecords;
+            continue;
+        }
+        LaneRecord copy = slot->record;
+        uint64_t stamp = slot->timestampNs;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->sequence.load(std::memory_order_relaxed) != sequence) {
+            ++droppedRecords;
+            continue;
+        }
+        record = copy;
+        timestampNs = stamp;
+        return true;
+    }
+}
+
+ResultSlot *ResultRing::slotAt(uint64_t sequence) const {
+    return reinterpret_cast<ResultSlot*>( \
+        reinterpret_cast<unsigned char*>(header) + sizeof(ResultRingHeader) + \
+        ((sequence - 1) % header->slotCount) * sizeof(ResultSlot));
+}
@@ -0,0 +1,269 @@
+/************************************************************************************************
+* @file      : Implementation for the result sinks
+* @author    : Arun Kumar Devarajulu
+* @brief     : The VideoSink encodes annotated frames, the CsvSink writes the lane
+*              geometry of every frame as text and the BinarySink writes it as
+*              fixed size binary records
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "ResultSink.hpp"
+#include <string>
+#include <iomanip>
+#include <cstring>
+#include <boost/filesystem.hpp>
+
+namespace FS = boost::filesystem;
+
+/***
+*@brief  : The resumeFile() function truncates the file, so that the outputs
+*          of frames after the checkpoint are written once only
+*****/
+bool ResultSink::resumeFile(const std::string& path, long long position) {
+    boost::system::error_code failure;
+    uintmax_t size = FS::file_size(path, failure);
+    if (failure || position < 0 || size < static_cast<uintmax_t>(position))
+        return false;
+    if (size > static_cast<uintmax_t>(position))
+        FS::resize_file(path, static_cast<uintmax_t>(position), failure);
+    return !failure;
+}
+
+/***
+*@brief  : The VideoSink constructor opens the video writer. Codecs which are not
+*          written as exactly four characters fall back to MJPG.
+*@params : path is the location of the output video file
+*@params : codec is the four character code of the video codec
+*@params : fps is the frame rate of the output video
+*@params : size is the size of the output frames
+*****/
+VideoSink::VideoSink(const std::string& path, const std::string& codec, \
+                     double fps, cv::Size size) {
+    std::string fourcc = codec.size() == 4 ? codec : "MJPG";
+    video.open(path, CV_FOURCC(fourcc[0], fourcc[1], fourcc[2], fourcc[3]), \
+               fps, size);
+    if (!video.isOpened()) {
+        std::cout << "Error opening output video file " << path << std::endl;
+    }
+}
+
+void VideoSink::write(const cv::Mat& frame, const LaneResult& result) {
+    (void)result;
+    if (video.isOpened() && !frame.empty())
+        video.write(frame);
+}
+
+void VideoSink::close() {
+    video.release();
+}
+
+/***
+*@brief  : The CsvSink constructor opens the results file and writes the column
+*          names. The columns are the frame index, the left and right lane end
+*          points, the four polygon vertices, the two slopes, the turn
+*          prediction and the status bits.
+*@params : path is the location of the output results file
+*@params : resumeAt is the position of a checkpoint, -1 for a new file
+*****/
+CsvSink::CsvSink(const std::string& path, long long resumeAt) {
+    if (resumeAt >= 0 && !resumeFile(path, resumeAt)) {
+        std::cout << "Error resuming results file " << path << std::endl;
+        return;
+    }
+    // A resumed file is opened for update and continued at its end
+    resultsFile.open(path, resumeAt >= 0 ? std::ios::in | std::ios::out : \
+                                           std::ios::out);
+    if (!resultsFile.is_open()) {
+        std::cout << "Error opening results file " << path << std::endl;
+        return;
+    }
+    resultsFile.seekp(0, std::ios::end);
+    resultsFile << std::fixed << std::setprecision(3);
+    if (resumeAt >= 0)
+        return;
+    resultsFile << "frame,left_x1,left_y1,left_x2,left_y2,"
+                   "right_x1,right_y1,right_x2,right_y2,"
+                   "poly_x1,poly_y1,poly_x2,poly_y2,"
+                   "poly_x3,poly_y3,poly_x4,poly_y4,"
+                   "slope_left,slope_right,turn,status\n";
+}
+
+void CsvSink::write(const cv::Mat& frame, const LaneResult& result) {
+    (void)frame;
+    if (!resultsFile.is_open())
+        return;
+    writeRow(resultsFile, result);
+    resultsFile << "\n";
+}
+
+void CsvSink::writeRow(std::ostream& out, const LaneResult& result) {
+    static const char *turnNames[] = {"none", "left", "right"};
+    out << result.frameIndex << ","
+        << result.leftLine.first.x << "," << result.leftLine.first.y << ","
+        << result.leftLine.second.x << "," << result.leftLine.second.y << ","
+        << result.rightLine.first.x << "," << result.rightLine.first.y << ","
+        << result.rightLine.second.x << "," << result.rightLine.second.y;
+    for (size_t i = 0; i < 4; i++) {
+        cv::Point vertex = i < result.polygon.size() ? result.polygon[i] : \
+                           cv::Point();
+        out << "," << vertex.x << "," << vertex.y;
+    }
+    out << "," << result.slopeLeft << "," << result.slopeRight << ","
+        << turnNames[result.turn] << "," << result.status;
+}
+
+void CsvSink::close() {
+    if (resultsFile.is_open())
+        resultsFile.close();
+}
+
+long long CsvSink::position() {
+    if (!resultsFile.is_open())
+        return -1;
+    resultsFile.flush();
+    return static_cast<long long>(resultsFile.tellp());
+}
+
+/***
+*@brief  : The BinarySink constructor opens the results file and writes the header
+*@params : path is the location of the output results file
+*@params : header is the file header written before the first record
+*@params : resumeAt is the position of a checkpoint, -1 for a new file
+*****/
+BinarySink::BinarySink(const std::string& path, const LaneFileHeader& header, \
+                       long long resumeAt) {
+    if (resumeAt >= 0 && !resumeFile(path, resumeAt)) {
+        std::cout << "Error resuming results file " << path << std::endl;
+        return;
+    }
+    resultsFile.open(path, std::ios::binary | std::ios::out | \
+                     (resumeAt >= 0 ? std::ios::in : std::ios::trunc));
+    if (!resultsFile.is_open()) {
+        std::cout << "Error opening results file " << path << std::endl;
+        return;
+    }
+    resultsFile.seekp(0, std::ios::end);
+    if (resumeAt < 0)
+        resultsFile.write(reinterpret_cast<const char *>(&header), \
+                          sizeof(header));
+}
+
+void BinarySink::write(const cv::Mat& frame, const LaneResult& result) {
+    (void)frame;
+    if (!resultsFile.is_open())
+        return;
+    LaneRecord record = toRecord(result);
+    resultsFile.write(reinterpret_cast<const char *>(&record), sizeof(record));
+}
+
+void BinarySink::close() {
+    if (resultsFile.is_open())
+        resultsFile.close();
+}
+
+long long BinarySink::position() {
+    if (!resultsFile.is_open())
+        return -1;
+    resultsFile.flush();
+    return static_cast<long long>(resultsFile.tellp());
+}
+
+/***
+*@brief  : The makeHeader() function fills the header fields. The calibration hash
+*          covers the camera matrix and the distortion coefficients as doubles,
+*          so two runs with the same calibration always get the same hash.
+*@return : The file header
+*****/
+LaneFileHeader BinarySink::makeHeader(cv::Size frame, cv::Mat camParams, \
+                                      cv::Mat distCoeffs, cv::Scalar wMin, \
+                                      cv::Scalar wMax, cv::Scalar yMin, \
+                                      cv::Scalar yMax, double processScale) {
+    LaneFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kLaneFileMagic, sizeof(kLaneFileMagic));
+    header.version = kLaneFileVersion;
+    header.headerSize = sizeof(LaneFileHeader);
+    header.recordSize = sizeof(LaneRecord);
+    header.width = frame.width;
+    header.height = frame.height;
+
+    cv::Mat cam, dist;
+    camParams.convertTo(cam, CV_64F);
+    distCoeffs.convertTo(dist, CV_64F);
+    header.calibrationHash = laneHash(cam.ptr<double>(), \
+                                      cam.total() * sizeof(double));
+    header.calibrationHash = laneHash(dist.ptr<double>(), \
+                                      dist.total() * sizeof(double), \
+                                      header.calibrationHash);
+
+    for (int i = 0; i < 3; i++) {
+        header.whiteMin[i] = wMin[i];
+        header.whiteMax[i] = wMax[i];
+        header.yellowMin[i] = yMin[i];
+        header.yellowMax[i] = yMax[i];
+    }
+    header.processScale = processScale;
+    return header;
+}
+
+LaneRecord BinarySink::toRecord(const LaneResult& result) {
+    LaneRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.frameIndex = static_cast<uint64_t>(result.frameIndex);
+    record.leftLine[0] = static_cast<float>(result.leftLine.first.x);
+    record.leftLine[1] = static_cast<float>(result.leftLine.first.y);
+    record.leftLine[2] = static_cast<float>(result.leftLine.second.x);
+    record.leftLine[3] = static_cast<float>(result.leftLine.second.y);
+    record.rightLine[0] = static_cast<float>(result.rightLine.first.x);
+    record.rightLine[1] = static_cast<float>(result.rightLine.first.y);
+    record.rightLine[2] = static_cast<float>(result.rightLine.second.x);
+    record.rightLine[3] = static_cast<float>(result.rightLine.second.y);
+    for (size_t i = 0; i < 4 && i < result.polygon.size(); i++) {
+        record.polygon[2 * i] = result.polygon[i].x;
+        record.polygon[2 * i + 1] = result.polygon[i].y;
+    }
+    record.slopeLeft = static_cast<float>(result.slopeLeft);
+    record.slopeRight = static_cast<float>(result.slopeRight);
+    record.turn = static_cast<uint32_t>(result.turn);
+    record.status = result.status;
+    return record;
+}
+
+LaneResult BinarySink::toResult(const LaneRecord& record) {
+    LaneResult result;
+    result.frameIndex = static_cast<long>(record.frameIndex);
+    result.leftLine = std::make_pair( \
+            cv::Point2d(record.leftLine[0], record.leftLine[1]), \
+            cv::Point2d(record.leftLine[2], record.leftLine[3]));
+    result.rightLine = std::make_pair( \
+            cv::Point2d(record.rightLine[0], record.rightLine[1]), \
+            cv::Point2d(record.rightLine[2], record.rightLine[3]));
+    for (int i = 0; i < 4; i++) {
+        result.polygon.push_back(cv::Point(record.polygon[2 * i], \
+                                           record.polygon[2 * i + 1]));
+    }
+    result.slopeLeft = record.slopeLeft;
+    result.slopeRight = record.slopeRight;
+    result.turn = static_cast<int>(record.turn);
+    result.status = record.status;
+    return result;
+}
@@ -0,0 +1,166 @@
+/************************************************************************************************
+* @file      : Stand-in producer for the shared memory frame ring
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ring-producer tool plays a video file or a directory of numbered frames into a
+*              frame ring at the frame rate of a camera, the way a capture process would, and reads
+*              the lanes back from the result ring of shell-app --ring. It reports how many frames
+*              came back and how long after their capture.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <boost/filesystem.hpp>
+#include "opencv2/opencv.hpp"
+#include "Arguments.hpp"
+#include "Files.hpp"
+#include "FrameEnumerator.hpp"
+#include "FrameSource.hpp"
+#include "ImageSequenceSource.hpp"
+#include "FrameRing.hpp"
+#include "ResultRing.hpp"
+
+namespace {
+typedef std::chrono::steady_clock Clock;
+
+uint64_t nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast< \
+        std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+}
+
+/***
+*@brief  : Counts the results which come back and their latency
+*****/
+struct ResultReader {
+    ResultRing *ring;   // < Result ring of the detector
+    long received = 0;   // < Results read
+    double latencySum = 0;   // < Sum of the capture to result times
+    double latencyMax = 0;   // < Largest capture to result time
+
+    void operator()() {
+        LaneRecord record;
+        uint64_t timestampNs;
+        while (ring->next(record, timestampNs, 10.0)) {
+            double latency = (nowNs() - timestampNs) / 1e6;
+            latencySum += latency;
+            latencyMax = std::max(latencyMax, latency);
+            ++received;
+        }
+    }
+};
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    Arguments args(argc, argv);
+    if (args.positional().empty()) {
+        std::cout << "Usage: ring-producer <video or frame directory> " \
+                  << "[--ring=lanes] [--slots=8] [--fps=30] [--wait=10]" \
+                  << std::endl;
+        return -1;
+    }
+    std::string address = args.positional().front();
+    std::unique_ptr<FrameEnumerator> frameList;
+    std::unique_ptr<FrameSource> source;
+    if (FS::is_directory(address)) {
+        frameList.reset(new FrameEnumerator(address));
+        FrameEnumerator *list = frameList.get();
+        source.reset(new ImageSequenceSource( \
+                [list](std::string& path) { return list->next(path); }, \
+                2, args.getDouble("fps", 30)));
+    } else {
+        source.reset(new VideoSource(address));
+    }
+    cv::Mat frame;
+    if (!source->isOpened() || !source->read(frame) || \
+        frame.type() != CV_8UC3) {
+        std::cout << "Error reading colour frames from " << address \
+                  << std::endl;
+        return -1;
+    }
+
+    std::string name = args.getString("ring", "lanes");
+    FrameRing ring;
+    if (!ring.create(name, static_cast<uint32_t>( \
+                     std::max(1, args.getInt("slots", 8))), \
+                     static_cast<uint32_t>(frame.total() * 3))) {
+        std::cout << "Error creating the frame ring: " << ring.error() \
+                  << std::endl;
+        return -1;
+    }
+
+    // The detector creates the result ring once it has attached
+    std::cout << "Waiting for shell-app --ring=" << name << std::endl;
+    ResultRing results;
+    Clock::time_point waitEnd = Clock::now() + \
+        std::chrono::milliseconds(static_cast<int64_t>( \
+            args.getDouble("wait", 10) * 1000));
+    while (!results.attach(name + "-results")) {
+        if (Clock::now() >= waitEnd) {
+            std::cout << "No detector attached to " << name << std::endl;
+            return -1;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    ResultReader reader;
+    reader.ring = &results;
+    std::thread readerThread(std::ref(reader));
+
+    double fps = args.getDouble("fps", 30);
+    Clock::duration period = fps > 0 ? \
+        std::chrono::duration_cast<Clock::duration>( \
+            std::chrono::duration<double>(1.0 / fps)) : Clock::duration(0);
+    Clock::time_point due = Clock::now();
+    long published = 0;
+    do {
+        std::this_thread::sleep_until(due);
+        due += period;
+        if (!frame.isContinuous())
+            frame = frame.clone();
+        FrameView view;
+        view.data = frame.data;
+        view.stride = frame.step;
+        view.width = frame.cols;
+        view.height = frame.rows;
+        view.format = PIXEL_BGR;
+        if (ring.publish(view, nowNs()))
+            ++published;
+    } while (source->read(frame));
+    ring.finish();
+    readerThread.join();
+    source->release();
+
+    std::cout << published << " frames published, " << reader.received \
+              << " results, " << published - reader.received \
+              << " frames lost" << std::endl;
+    if (reader.received > 0) {
+        std::cout << "Latency " << reader.latencySum / reader.received \
+                  << " ms mean, " << reader.latencyMax << " ms max" \
+                  << std::endl;
+    }
+    return 0;
+}
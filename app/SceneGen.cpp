@@ -0,0 +1,144 @@
+/************************************************************************************************
+* @file      : Synthetic road scene generator tool
+* @author    : Arun Kumar Devarajulu
+* @brief     : The scene-gen tool renders a synthetic drive with the SceneGenerator class into a video
+*              file, a directory of numbered PNG frames or a frame cache file, and writes the true
+*              lane centres of every frame as CSV.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <boost/filesystem.hpp>
+#include "opencv2/opencv.hpp"
+#include "Arguments.hpp"
+#include "FrameCacheSource.hpp"
+#include "SceneGenerator.hpp"
+
+namespace FS = boost::filesystem;    //! Short form for boost filesystem
+
+namespace {
+/***
+*@brief  : Writes the lane centres of a frame, one CSV row per sampled row
+*****/
+void writeTruth(std::ostream& out, const SceneTruth& truth) {
+    for (size_t i = 0; i < truth.left.size() && i < truth.right.size(); i++) {
+        out << truth.frameIndex << "," << truth.left[i].y << "," \
+            << truth.left[i].x << "," << truth.right[i].x << "\n";
+    }
+}
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    Arguments args(argc, argv);
+    if (args.positional().empty()) {
+        std::cout << "Usage: scene-gen <video, frame directory or .lraw> " \
+                  << "[--frames=300] [--width=1280] [--height=720] " \
+                  << "[--curvature=0] [--left=solid-yellow] " \
+                  << "[--right=dashed-white] [--shadows=0] [--noise=0] " \
+                  << "[--no-distortion] [--speed=0.05] [--seed=1] " \
+                  << "[--fps=30] [--truth=<csv>]" << std::endl;
+        return -1;
+    }
+    std::string output = args.positional().front();
+    SceneGenerator::Settings settings;
+    settings.size = cv::Size(args.getInt("width", 1280), \
+                             args.getInt("height", 720));
+    settings.curvature = args.getDouble("curvature", 0);
+    settings.left = SceneGenerator::readMarking(args.getString("left", ""), \
+                                                settings.left);
+    settings.right = SceneGenerator::readMarking(args.getString("right", ""), \
+                                                 settings.right);
+    settings.shadows = args.getInt("shadows", 0);
+    settings.noise = args.getDouble("noise", 0);
+    settings.distort = !args.has("no-distortion");
+    settings.speed = args.getDouble("speed", 0.05);
+    settings.seed = static_cast<unsigned>(args.getInt("seed", 1));
+    long frames = args.getInt("frames", 300);
+    double fps = args.getDouble("fps", 30);
+    if (settings.size.area() <= 0 || frames <= 0) {
+        std::cout << "The size and the number of frames must be positive" \
+                  << std::endl;
+        return -1;
+    }
+
+    std::ofstream truthFile;
+    if (args.has("truth")) {
+        truthFile.open(args.getString("truth", ""));
+        truthFile << "frame,row,left_x,right_x\n" << std::fixed \
+                  << std::setprecision(3);
+    }
+
+    // A frame cache file is filled straight from the scene source
+    SceneSource scene(settings, frames, fps);
+    if (FS::path(output).extension() == ".lraw") {
+        std::string error;
+        long written = FrameCacheSource::build(scene, output, error);
+        if (written < 0) {
+            std::cout << "Error writing " << output << ": " << error \
+                      << std::endl;
+            return -1;
+        }
+        if (truthFile.is_open()) {
+            SceneGenerator generator(settings);
+            SceneTruth truth;
+            for (long i = 0; i < frames; i++) {
+                generator.render(i, truth);
+                writeTruth(truthFile, truth);
+            }
+        }
+        std::cout << written << " frames written to " << output << std::endl;
+        return 0;
+    }
+
+    bool directory = !FS::path(output).has_extension();
+    cv::VideoWriter video;
+    if (directory) {
+        FS::create_directories(output);
+    } else {
+        video.open(output, cv::VideoWriter::fourcc('M', 'J', 'P', 'G'), \
+                   fps, settings.size);
+        if (!video.isOpened()) {
+            std::cout << "Error opening " << output << std::endl;
+            return -1;
+        }
+    }
+    cv::Mat frame;
+    long written = 0;
+    char name[32];
+    while (scene.read(frame)) {
+        if (directory) {
+            std::snprintf(name, sizeof(name), "/frame_%06ld.png", written);
+            cv::imwrite(output + name, frame);
+        } else {
+            video << frame;
+        }
+        if (truthFile.is_open())
+            writeTruth(truthFile, scene.truth());
+        written++;
+    }
+    std::cout << written << " frames written to " << output << std::endl;
+    return 0;
+}
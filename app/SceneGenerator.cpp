@@ -0,0 +1,240 @@
+/************************************************************************************************
+* @file      : Implementation for SceneGenerator class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The SceneGenerator class renders synthetic road frames with their true lanes
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "SceneGenerator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "LaneGeometry.hpp"
+
+namespace {
+// Vanishing point as a fraction of the frame, inside the region of interest
+const double kVanishX = 0.535, kVanishY = 0.62;
+// Bottom row columns of the lane markings as a fraction of the width
+const double kLeftBottom = 0.27, kRightBottom = 0.86;
+// Marking width on the bottom row as a fraction of the width
+const double kMarkingWidth = 0.018;
+// Road distance from one dash to the next, the bottom row is at distance one
+const double kDashPeriod = 0.5;
+// Farthest distance a shadow starts at
+const double kShadowRange = 4.0;
+// Brightness left in a shadow
+const double kShadowDepth = 0.55;
+// Pixel spacing of the exactly computed lens distortion points
+const int kDistortStep = 8;
+
+const cv::Vec3b kRoad(92, 90, 88);
+const cv::Vec3b kSkyTop(200, 160, 110);
+const cv::Vec3b kSkyHorizon(170, 165, 160);
+const cv::Vec3b kWhite(230, 230, 230);
+const cv::Vec3b kYellow(20, 190, 240);
+
+/***
+*@brief  : Fills the columns [first, last] of a row, clipped to the row
+*****/
+void fillSpan(cv::Vec3b *row, int width, double first, double last, \
+              const cv::Vec3b& color) {
+    int begin = std::max(0, static_cast<int>(std::lround(first)));
+    int end = std::min(width - 1, static_cast<int>(std::lround(last)));
+    for (int x = begin; x <= end; x++)
+        row[x] = color;
+}
+}  // namespace
+
+double SceneTruth::xAt(const std::vector<cv::Point2d>& lane, double row) {
+    if (lane.empty() || row < lane.front().y || row > lane.back().y)
+        return std::numeric_limits<double>::quiet_NaN();
+    auto after = std::lower_bound(lane.begin(), lane.end(), row, \
+        [](const cv::Point2d& point, double y) { return point.y < y; });
+    if (after == lane.begin())
+        return after->x;
+    auto before = after - 1;
+    double part = (row - before->y) / (after->y - before->y);
+    return before->x + part * (after->x - before->x);
+}
+
+/***
+*@brief  : The constructor inverts the lens model of the Cleaner class. The
+*          undistorted position of a pixel is computed exactly on a coarse
+*          grid with cv::undistortPoints and interpolated in between.
+*****/
+SceneGenerator::SceneGenerator(const Settings& settings) : \
+    options(settings), vanishX(kVanishX * settings.size.width), \
+    vanishY(kVanishY * settings.size.height) {
+    if (!options.distort)
+        return;
+    const LaneConfig& camera = options.camera;
+    cv::Mat cameraMatrix = LaneGeometry(1.0, camera.roi, \
+        camera.calibrationSize).cameraMatrix(camera.camParams, options.size);
+    int gridCols = options.size.width / kDistortStep + 2;
+    int gridRows = options.size.height / kDistortStep + 2;
+    std::vector<cv::Point2f> grid, ideal;
+    for (int row = 0; row < gridRows; row++) {
+        for (int col = 0; col < gridCols; col++)
+            grid.push_back(cv::Point2f(col * kDistortStep, row * kDistortStep));
+    }
+    cv::undistortPoints(grid, ideal, cameraMatrix, camera.distCoeffs, \
+                        cv::noArray(), cameraMatrix);
+    cv::Mat coarseX(gridRows, gridCols, CV_32F);
+    cv::Mat coarseY(gridRows, gridCols, CV_32F);
+    for (int row = 0; row < gridRows; row++) {
+        for (int col = 0; col < gridCols; col++) {
+            coarseX.at<float>(row, col) = ideal[row * gridCols + col].x;
+            coarseY.at<float>(row, col) = ideal[row * gridCols + col].y;
+        }
+    }
+    cv::Mat gridX(options.size, CV_32F), gridY(options.size, CV_32F);
+    for (int row = 0; row < options.size.height; row++) {
+        float *xs = gridX.ptr<float>(row);
+        float *ys = gridY.ptr<float>(row);
+        for (int col = 0; col < options.size.width; col++) {
+            xs[col] = static_cast<float>(col) / kDistortStep;
+            ys[col] = static_cast<float>(row) / kDistortStep;
+        }
+    }
+    cv::remap(coarseX, distortX, gridX, gridY, cv::INTER_LINEAR);
+    cv::remap(coarseY, distortY, gridX, gridY, cv::INTER_LINEAR);
+}
+
+double SceneGenerator::laneColumn(double offset, double depth) const {
+    return vanishX + depth * offset + options.curvature * \
+           options.size.width * (1 - depth) * (1 - depth);
+}
+
+cv::Mat SceneGenerator::render(long frameIndex, SceneTruth& truth) const {
+    int width = options.size.width, height = options.size.height;
+    int firstRoadRow = static_cast<int>(std::floor(vanishY)) + 1;
+    cv::Mat ideal(options.size, CV_8UC3);
+    for (int y = 0; y < height; y++) {
+        cv::Vec3b color = kRoad;
+        if (y < firstRoadRow) {
+            double part = y / vanishY;
+            for (int i = 0; i < 3; i++)
+                color[i] = cv::saturate_cast<uchar>(kSkyTop[i] * (1 - part) + \
+                                                    kSkyHorizon[i] * part);
+        }
+        cv::Vec3b *row = ideal.ptr<cv::Vec3b>(y);
+        std::fill(row, row + width, color);
+    }
+
+    // The markings and their centres are drawn row by row
+    const Marking markings[2] = {options.left, options.right};
+    const double bottoms[2] = {kLeftBottom * width - vanishX, \
+                               kRightBottom * width - vanishX};
+    std::vector<cv::Point2d>* lanes[2] = {&truth.left, &truth.right};
+    truth.frameIndex = frameIndex;
+    truth.left.clear();
+    truth.right.clear();
+    int truthStep = std::max(1, (height - firstRoadRow) / 180);
+    for (int y = firstRoadRow; y < height; y++) {
+        double depth = (y - vanishY) / (height - vanishY);
+        double halfWidth = std::max(0.5, kMarkingWidth * width * depth / 2);
+        double phase = std::fmod(1 / depth / kDashPeriod + \
+                                 frameIndex * options.speed, 1.0);
+        cv::Vec3b *row = ideal.ptr<cv::Vec3b>(y);
+        for (int side = 0; side < 2; side++) {
+            double centre = laneColumn(bottoms[side], depth);
+            if ((y - firstRoadRow) % truthStep == 0 || y == height - 1)
+                lanes[side]->push_back(cv::Point2d(centre, y));
+            if (markings[side].dashed && phase >= 0.5)
+                continue;
+            fillSpan(row, width, centre - halfWidth, centre + halfWidth, \
+                     markings[side].yellow ? kYellow : kWhite);
+        }
+    }
+
+    // Shadows are rectangles on the road which come closer as we drive and
+    // darken the markings as well
+    double travelled = frameIndex * options.speed * kDashPeriod;
+    for (int shadow = 0; shadow < options.shadows; shadow++) {
+        cv::RNG rng(options.seed * 7919ULL + shadow);
+        double start = rng.uniform(1.0, kShadowRange);
+        double length = rng.uniform(0.3, 1.5);
+        double side = rng.uniform(-0.6, 0.3) * width;
+        double across = rng.uniform(0.2, 0.7) * width;
+        double near = 1 + std::fmod(start - 1 - travelled, kShadowRange - 1);
+        if (near < 1)
+            near += kShadowRange - 1;
+        for (int y = firstRoadRow; y < height; y++) {
+            double depth = (y - vanishY) / (height - vanishY);
+            double distance = 1 / depth;
+            if (distance < near || distance > near + length)
+                continue;
+            cv::Vec3b *row = ideal.ptr<cv::Vec3b>(y);
+            int begin = std::max(0, static_cast<int>( \
+                laneColumn(side, depth)));
+            int end = std::min(width - 1, static_cast<int>( \
+                laneColumn(side + across, depth)));
+            for (int x = begin; x <= end; x++) {
+                for (int i = 0; i < 3; i++)
+                    row[x][i] = cv::saturate_cast<uchar>(row[x][i] * \
+                                                         kShadowDepth);
+            }
+        }
+    }
+
+    cv::Mat frame;
+    if (options.distort) {
+        cv::remap(ideal, frame, distortX, distortY, cv::INTER_LINEAR, \
+                  cv::BORDER_REPLICATE);
+    } else {
+        frame = ideal;
+    }
+    if (options.noise > 0) {
+        cv::RNG rng(options.seed * 2654435761ULL + frameIndex);
+        cv::Mat noise(options.size, CV_16SC3), wide;
+        rng.fill(noise, cv::RNG::NORMAL, 0, options.noise);
+        frame.convertTo(wide, CV_16SC3);
+        wide += noise;
+        wide.convertTo(frame, CV_8UC3);
+    }
+    return frame;
+}
+
+SceneGenerator::Marking SceneGenerator::readMarking(const std::string& text, \
+                                                    Marking fallback) {
+    if (text.find("solid") != std::string::npos)
+        fallback.dashed = false;
+    if (text.find("dashed") != std::string::npos)
+        fallback.dashed = true;
+    if (text.find("white") != std::string::npos)
+        fallback.yellow = false;
+    if (text.find("yellow") != std::string::npos)
+        fallback.yellow = true;
+    return fallback;
+}
+
+SceneSource::SceneSource(const SceneGenerator::Settings& settings, \
+                         long frames, double rate) : generator(settings), \
+    frameCount(frames), frameRate(rate) {}
+
+bool SceneSource::read(cv::Mat& frame) {
+    if (nextFrame >= frameCount)
+        return false;
+    frame = generator.render(nextFrame++, lastTruth);
+    return true;
+}
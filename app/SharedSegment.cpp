@@ -0,0 +1,104 @@
+/************************************************************************************************
+* @file      : Implementation for SharedSegment class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The SharedSegment class maps named POSIX shared memory segments
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "SharedSegment.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string>
+
+namespace {
+std::string segmentPath(const std::string& name) {
+    return !name.empty() && name[0] == '/' ? name : "/" + name;
+}
+}  // namespace
+
+bool SharedSegment::create(const std::string& name, size_t bytes) {
+    close();
+    segmentName = segmentPath(name);
+    shm_unlink(segmentName.c_str());
+    int fd = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+    if (fd < 0) {
+        lastError = "cannot create shared memory " + segmentName;
+        return false;
+    }
+    if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        ::close(fd);
+        shm_unlink(segmentName.c_str());
+        lastError = "cannot size shared memory " + segmentName;
+        return false;
+    }
+    base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        base = nullptr;
+        shm_unlink(segmentName.c_str());
+        lastError = "cannot map shared memory " + segmentName;
+        return false;
+    }
+    mappedBytes = bytes;
+    owner = true;
+    return true;
+}
+
+bool SharedSegment::attach(const std::string& name) {
+    close();
+    segmentName = segmentPath(name);
+    int fd = shm_open(segmentName.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        lastError = "cannot open shared memory " + segmentName;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        lastError = "shared memory " + segmentName + " is empty";
+        return false;
+    }
+    mappedBytes = static_cast<size_t>(info.st_size);
+    base = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_SHARED, \
+                fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        base = nullptr;
+        mappedBytes = 0;
+        lastError = "cannot map shared memory " + segmentName;
+        return false;
+    }
+    owner = false;
+    return true;
+}
+
+void SharedSegment::close() {
+    if (base != nullptr)
+        munmap(base, mappedBytes);
+    if (owner)
+        shm_unlink(segmentName.c_str());
+    base = nullptr;
+    mappedBytes = 0;
+    owner = false;
+}
@@ -0,0 +1,144 @@
+/************************************************************************************************
+* @file      : Implementation for ThreadPool class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ThreadPool class runs tasks on worker threads with per-worker queues and
+*              work stealing
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#include "ThreadPool.hpp"
+#include "CoreScheduler.hpp"
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace {
+// Pool and queue of the worker running on this thread, if any
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local size_t currentQueue = 0;
+}  // namespace
+
+ThreadPool::ThreadPool(int workers, const std::vector<int>& cores) : \
+                       nextQueue(0), stealCount(0) {
+    workers = std::max(1, workers);
+    for (int i = 0; i < workers; i++) {
+        queues.emplace_back(new Queue());
+    }
+    for (int i = 0; i < workers; i++) {
+        int core = cores.empty() ? -1 : cores[i % cores.size()];
+        threads.emplace_back(&ThreadPool::work, this, static_cast<size_t>(i), \
+                             core);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    taskQueued.notify_all();
+    for (auto& worker : threads) {
+        if (worker.joinable())
+            worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    size_t target = currentPool == this ? currentQueue : \
+                    nextQueue++ % queues.size();
+    // The counters go up first so that they never drop below zero when a
+    // worker takes the task right away
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        queued++;
+        pending++;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queues[target]->lock);
+        queues[target]->tasks.push_back(std::move(task));
+    }
+    taskQueued.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    allDone.wait(lock, [this] { return pending == 0; });
+}
+
+bool ThreadPool::take(size_t self, std::function<void()>& task) {
+    {
+        Queue& own = *queues[self];
+        std::lock_guard<std::mutex> lock(own.lock);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+    for (size_t i = 1; i < queues.size(); i++) {
+        Queue& other = *queues[(self + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(other.lock);
+        if (!other.tasks.empty()) {
+            task = std::move(other.tasks.front());
+            other.tasks.pop_front();
+            stealCount++;
+            return true;
+        }
+    }
+    return false;
+}
+
+/***
+*@brief  : The work() function runs tasks as long as any queue has one and
+*          sleeps otherwise. The queued counter is only a hint for waking up,
+*          a worker which finds nothing after waking up goes back to sleep.
+*          A worker given a core pins itself to it first.
+*****/
+void ThreadPool::work(size_t self, int core) {
+    if (core >= 0)
+        CoreScheduler::pinCurrent(std::vector<int>(1, core));
+    currentPool = this;
+    currentQueue = self;
+    while (true) {
+        std::function<void()> task;
+        if (take(self, task)) {
+            {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                queued--;
+            }
+            task();
+            bool finished;
+            {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                finished = --pending == 0;
+            }
+            if (finished)
+                allDone.notify_all();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(stateMutex);
+        taskQueued.wait(lock, [this] { return stopping || queued > 0; });
+        if (stopping)
+            return;
+    }
+}
@@ -26,6 +26,87 @@
 *              SOFTWARE.
 *************************************************************************************************/
 #include "Thresholder.hpp"
+#include <vector>
+#include <algorithm>
+
+namespace {
+// Colors of the calibration grid along each BGR axis
+const int kGridSteps = 64;
+
+/***
+*@brief  : Finds the Y, U, V box with the largest intersection over union with
+*          the labeled samples. Every bound in turn moves to its best value
+*          for the other five, until no bound improves. Histograms along one
+*          axis of the samples inside the box on the other two give the
+*          overlap of all values of a bound in a single pass.
+*@params : samples are the Y, U, V values
+*@params : labels are non-zero for the samples which belong into the box
+*@params : low and high receive the box
+*@return : The intersection over union of the box
+*****/
+double fitBox(const std::vector<cv::Vec3b>& samples, \
+              const std::vector<uchar>& labels, int low[3], int high[3]) {
+    long positives = 0;
+    for (int c = 0; c < 3; c++) {
+        low[c] = 255;
+        high[c] = 0;
+    }
+    for (size_t i = 0; i < samples.size(); i++) {
+        if (!labels[i])
+            continue;
+        positives++;
+        for (int c = 0; c < 3; c++) {
+            low[c] = std::min(low[c], static_cast<int>(samples[i][c]));
+            high[c] = std::max(high[c], static_cast<int>(samples[i][c]));
+        }
+    }
+    if (positives == 0)
+        return 0;
+
+    double best = -1;
+    for (int pass = 0; pass < 16; pass++) {
+        bool improved = false;
+        for (int axis = 0; axis < 3; axis++) {
+            std::vector<long> hits(257, 0), misses(257, 0);
+            int first = (axis + 1) % 3, second = (axis + 2) % 3;
+            for (size_t i = 0; i < samples.size(); i++) {
+                const cv::Vec3b& sample = samples[i];
+                if (sample[first] < low[first] || \
+                    sample[first] > high[first] || \
+                    sample[second] < low[second] || \
+                    sample[second] > high[second])
+                    continue;
+                (labels[i] ? hits : misses)[sample[axis] + 1]++;
+            }
+            for (int value = 1; value <= 256; value++) {
+                hits[value] += hits[value - 1];
+                misses[value] += misses[value - 1];
+            }
+            // Samples outside the box are false negatives, so the union
+            // is all the positives and the false positives
+            for (int bound = 0; bound < 2; bound++) {
+                int from = bound == 0 ? 0 : low[axis];
+                int to = bound == 0 ? high[axis] : 255;
+                for (int value = from; value <= to; value++) {
+                    int lowest = bound == 0 ? value : low[axis];
+                    int highest = bound == 0 ? high[axis] : value;
+                    double score = static_cast<double>(hits[highest + 1] - \
+                                   hits[lowest]) / (positives + \
+                                   misses[highest + 1] - misses[lowest]);
+                    if (score > best + 1e-12) {
+                        best = score;
+                        (bound == 0 ? low : high)[axis] = value;
+                        improved = true;
+                    }
+                }
+            }
+        }
+        if (!improved)
+            break;
+    }
+    return best;
+}
+}  // namespace
 
 /***
 *@brief  : The convertToLab() converts an input BGR image to an output L*a*b
@@ -78,3 +159,94 @@ cv::Mat Thresholder::combineLanes() {
     return lanesMask;
 }
 
+
+Thresholder::LaneRule Thresholder::laneRule() const {
+    return anyOf(PixelRange<uchar, 3>(whiteMin, whiteMax), \
+                 PixelRange<uchar, 3>(yellowMin, yellowMax));
+}
+
+LANE_CLONES
+void Thresholder::maskRows(const cv::Mat& bgr, const cv::Mat& roi, \
+                           cv::Mat& lanes, cv::Mat& interest) const {
+    bool fused = fuseMask(bgr, ConvertPixels(cv::COLOR_BGR2Lab), laneRule(), \
+                          roi, lanes, interest);
+    CV_Assert(fused);
+}
+
+/***
+*@brief  : The yuvBounds() function places every color of the grid in a 2x2
+*          block, so that cv::COLOR_BGR2YUV_I420 gives it its own chroma
+*          sample, and reads its Y, U and V from the planes of the result.
+*          The grid has 64 steps per channel from 0 to 255, 262144 colors.
+*          A bound at the end of the values the grid reaches is opened up
+*          to 0 or 255, since decoders also give values outside of the
+*          nominal Y, U, V ranges.
+*****/
+double Thresholder::yuvBounds(const cv::Scalar& labMin, \
+                              const cv::Scalar& labMax, cv::Scalar& yuvMin, \
+                              cv::Scalar& yuvMax) {
+    const int side = kGridSteps * kGridSteps * kGridSteps / 512;
+    cv::Mat colors(side, 512, CV_8UC3);
+    const double step = 255.0 / (kGridSteps - 1);
+    for (int i = 0; i < colors.rows * colors.cols; i++) {
+        colors.at<cv::Vec3b>(i / colors.cols, i % colors.cols) = cv::Vec3b( \
+            cv::saturate_cast<uchar>(i / (kGridSteps * kGridSteps) * step), \
+            cv::saturate_cast<uchar>(i / kGridSteps % kGridSteps * step), \
+            cv::saturate_cast<uchar>(i % kGridSteps * step));
+    }
+    cv::Mat lab, inside, blocks, planes;
+    cv::cvtColor(colors, lab, cv::COLOR_BGR2Lab);
+    cv::inRange(lab, labMin, labMax, inside);
+    cv::resize(colors, blocks, cv::Size(), 2, 2, cv::INTER_NEAREST);
+    cv::cvtColor(blocks, planes, cv::COLOR_BGR2YUV_I420);
+
+    size_t count = colors.total();
+    const uchar* u = planes.ptr<uchar>(blocks.rows);
+    const uchar* v = u + count;
+    std::vector<cv::Vec3b> samples(count);
+    std::vector<uchar> labels(count);
+    cv::Vec3b lowest(255, 255, 255), highest(0, 0, 0);
+    for (size_t i = 0; i < count; i++) {
+        int row = static_cast<int>(i / colors.cols);
+        int col = static_cast<int>(i % colors.cols);
+        samples[i] = cv::Vec3b(planes.at<uchar>(2 * row, 2 * col), u[i], v[i]);
+        labels[i] = inside.at<uchar>(row, col);
+        for (int c = 0; c < 3; c++) {
+            lowest[c] = std::min(lowest[c], samples[i][c]);
+            highest[c] = std::max(highest[c], samples[i][c]);
+        }
+    }
+    int low[3], high[3];
+    double overlap = fitBox(samples, labels, low, high);
+    for (int c = 0; overlap > 0 && c < 3; c++) {
+        if (low[c] == lowest[c])
+            low[c] = 0;
+        if (high[c] == highest[c])
+            high[c] = 255;
+    }
+    yuvMin = cv::Scalar(low[0], low[1], low[2]);
+    yuvMax = cv::Scalar(high[0], high[1], high[2]);
+    return overlap;
+}
+
+void Thresholder::calibrateYuv() {
+    if (calibrated)
+        return;
+    yuvBounds(whiteMin, whiteMax, whiteYuvMin, whiteYuvMax);
+    yuvBounds(yellowMin, yellowMax, yellowYuvMin, yellowYuvMax);
+    calibrated = true;
+}
+
+Thresholder::LaneRule Thresholder::yuvRule() const {
+    return anyOf(PixelRange<uchar, 3>(whiteYuvMin, whiteYuvMax), \
+                 PixelRange<uchar, 3>(yellowYuvMin, yellowYuvMax));
+}
+
+LANE_CLONES
+void Thresholder::maskNv12(const cv::Mat& luma, const cv::Mat& chroma, \
+                           const cv::Mat& roi, cv::Mat& lanes, \
+                           cv::Mat& interest) const {
+    CV_Assert(calibrated);
+    bool planar = fuseMaskNv12(luma, chroma, yuvRule(), roi, lanes, interest);
+    CV_Assert(planar);
+}
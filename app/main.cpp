@@ -38,10 +38,15 @@
 #include <utility>
 #include <cstdlib>
 #include <cmath>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+#include <csignal>
 #include "opencv2/core.hpp"
 #include "opencv2/opencv.hpp"
 #include <opencv2/core/core.hpp>
-#include <opencv2/highgui/highgui.hpp>
 #include "opencv2/features2d.hpp"
 #include "opencv2/xfeatures2d.hpp"
 #include <opencv2/imgproc/imgproc.hpp>
@@ -49,37 +54,433 @@
 #include "opencv2/calib3d.hpp"
 #include "opencv2/imgcodecs.hpp"
 #include "Files.hpp"
-#include "Cleaner.hpp"
-#include "Thresholder.hpp"
-#include "LanesMarker.hpp"
-#include "RegionMaker.hpp"
+#include "Arguments.hpp"
+#include "LaneResult.hpp"
+#include "ResultSink.hpp"
+#include "OutputWriter.hpp"
+#include "FrameSource.hpp"
+#include "ImageSequenceSource.hpp"
+#include "FrameCacheSource.hpp"
+#include "FrameEnumerator.hpp"
+#include "LaneConfig.hpp"
+#include "LaneStream.hpp"
+#include "ThreadPool.hpp"
+#include "LanePipeline.hpp"
+#include "FrameRing.hpp"
+#include "ResultRing.hpp"
+#include "LaneServer.hpp"
+#include "Checkpoint.hpp"
+#include "ResultCache.hpp"
+#include "PreviewRenderer.hpp"
+#include "CoreScheduler.hpp"
 
 namespace FS = boost::filesystem;    //! Short form for boost filesystem
 
-int main(int argc, char *argv[]) {
-    cv::Point p;
-    std::vector<cv::Point> historicLane;
-    cv::Point dummy;
-    dummy.x = 0;
-    dummy.y = 0;
-    int counter = 1;
-    for (int i = 0; i < 4; i++) {
-        historicLane.push_back(dummy);
-    }
-    //  Hardcoding certain parameters like screen area to search for, etc.
-    std::vector<cv::Point> roiPoints;   // <First fillConvexPoly points
-    roiPoints.push_back(cv::Point(527, 491));
-    roiPoints.push_back(cv::Point(812, 491));
-    roiPoints.push_back(cv::Point(1163, 704));
-    roiPoints.push_back(cv::Point(281, 704));
+/****************************************************************
+*
+*  @Brief: openSource() opens a video file, a frame cache file, or
+*          a directory of numbered image frames which is listed in
+*          the background and decoded ahead of the detector. The
+*          frame list of a directory has to outlive the source.
+*          With --yuv a video is asked for its decoded NV12 frames.
+*
+****************************************************************/
+
+std::unique_ptr<FrameSource> openSource(const std::string& address, \
+                                        const Arguments& args, \
+                                        int decoders, \
+                                        std::unique_ptr<FrameEnumerator>& \
+                                        frameList) {
+    if (FrameCacheSource::isCache(address))
+        return std::unique_ptr<FrameSource>(new FrameCacheSource(address));
+    if (!FS::is_directory(address))
+        return std::unique_ptr<FrameSource>(new VideoSource(address, \
+                                            args.has("yuv")));
+    frameList.reset(new FrameEnumerator(address, \
+                    static_cast<uint64_t>(std::max(0, \
+                    args.getInt("first-frame", 0)))));
+    FrameEnumerator* list = frameList.get();
+    return std::unique_ptr<FrameSource>(new ImageSequenceSource( \
+            [list](std::string& path) { return list->next(path); }, \
+            decoders, args.getDouble("fps", 30)));
+}
+
+/****************************************************************
+*
+*  @Brief: makeScheduler() sets up the scheduler of --cores and
+*          --thread-budget and pins the calling thread to the
+*          auxiliary cores, so that the decoding, output and socket
+*          threads it starts stay there. Without either option the
+*          threads run anywhere and OpenCV picks its thread count.
+*
+****************************************************************/
+
+bool makeScheduler(const Arguments& args, \
+                   std::unique_ptr<CoreScheduler>& scheduler) {
+    if (!args.has("cores") && !args.has("thread-budget"))
+        return true;
+    std::vector<int> cores = CoreScheduler::available();
+    if (args.has("cores") && !CoreScheduler::parseCores( \
+            args.getString("cores", ""), cores)) {
+        std::cout << "Malformed core list " << args.getString("cores", "") \
+                  << ", use numbers and ranges such as 0-3,8" << std::endl;
+        return false;
+    }
+    scheduler.reset(new CoreScheduler(cores, \
+                                      args.getInt("thread-budget", 0)));
+    if (!CoreScheduler::pinCurrent(scheduler->auxiliary())) {
+        std::cout << "Error pinning threads to the cores " \
+                  << args.getString("cores", "") << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/****************************************************************
+*
+*  @Brief: loadConfig() starts from the reference camera and the
+*          compiled-in detection settings, applies the --config
+*          file, such as the output of lane-tune, and lets an
+*          explicit --process-scale, --band-rows or --engine
+*          override it.
+*
+****************************************************************/
+
+bool loadConfig(const Arguments& args, LaneConfig& config) {
+    std::string error;
+    if (args.has("config") && \
+        !config.loadFile(args.getString("config", ""), error)) {
+        std::cout << "Error reading the configuration: " << error << std::endl;
+        return false;
+    }
+    if (args.has("process-scale"))
+        config.processScale = args.getDouble("process-scale", 1.0);
+    if (args.has("band-rows"))
+        config.bandRows = args.getInt("band-rows", -1);
+    if (args.has("engine") && !LaneConfig::engineFromName( \
+            args.getString("engine", ""), config.engine)) {
+        std::cout << "Unknown engine " << args.getString("engine", "") \
+                  << ", use hough or window" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/****************************************************************
+*
+*  @Brief: segmentPath() names the annotated video of a resumed
+*          job after the frame it starts at, such as
+*          LanesDetection.from5400.avi, since a video container
+*          cannot be continued like the results files.
+*
+****************************************************************/
+
+std::string segmentPath(const std::string& path, long frame) {
+    FS::path video(path);
+    return (video.parent_path() / (video.stem().string() + ".from" + \
+            std::to_string(frame) + video.extension().string())).string();
+}
+
+/****************************************************************
+*
+*  @Brief: Everything one stream of the multi-stream mode owns.
+*          The frames of a stream are processed one after the
+*          other, different streams run side by side.
+*
+****************************************************************/
+
+struct StreamJob {
+    LaneConfig config;   // < Calibration, region, thresholds and outputs
+    std::unique_ptr<FrameEnumerator> frameList;   // < Directory listing
+    std::unique_ptr<FrameSource> source;   // < Input frames
+    std::unique_ptr<LanePipeline> pipeline;   // < Gate, chain and history
+    OutputWriter output;   // < Results of the stream
+};
+
+/****************************************************************
+*
+*  @Brief: processStream() handles the next frame of a stream and
+*          queues the stream again. A continuation submitted from a
+*          worker stays in the queue of that worker, so a stream
+*          mostly stays on one core while idle workers steal the
+*          other streams.
+*
+****************************************************************/
+
+void processStream(ThreadPool& pool, StreamJob& job) {
+    cv::Mat frame;
+    if (!job.source->read(frame)) {
+        job.output.close();
+        job.source->release();
+        return;
+    }
+    int format = job.source->format();
+    LaneResult result = job.pipeline->process(LanePipeline::view(frame, \
+                                                                 format));
+    if (job.output.needsFrame()) {
+        frame = LanePipeline::bgr(frame, format);
+        LaneStream::annotate(frame, result);
+    }
+    job.output.push(frame, result);
+    pool.submit([&pool, &job] { processStream(pool, job); });
+}
+
+/****************************************************************
+*
+*  @Brief: runStreams() processes every stream listed in a streams
+*          file on one shared work-stealing thread pool and reports
+*          the aggregate throughput. OpenCV's own threading is
+*          turned off so that the pool is the only source of
+*          parallelism.
+*
+****************************************************************/
+
+int runStreams(const Arguments& args) {
+    LaneConfig base;
+    if (!loadConfig(args, base))
+        return -1;
+    std::string error;
+    std::vector<LaneConfig> configs = LaneConfig::loadStreams( \
+            args.getString("streams", ""), error, base);
+    if (configs.empty()) {
+        std::cout << "Error reading streams: " << error << std::endl;
+        return -1;
+    }
+
+    std::unique_ptr<CoreScheduler> scheduler;
+    if (!makeScheduler(args, scheduler))
+        return -1;
+
+    std::vector<std::unique_ptr<StreamJob>> jobs;
+    for (auto& config : configs) {
+        std::unique_ptr<StreamJob> job(new StreamJob());
+        job->config = config;
+        job->source = openSource(config.input, args, \
+                                 args.getInt("decode-threads", 1), \
+                                 job->frameList);
+        if (!job->source->isOpened()) {
+            std::cout << "Error opening " << config.input << std::endl;
+            return -1;
+        }
+        cv::Size frameSize = job->source->frameSize();
+        LanePipeline::Options options;
+        options.config = config;
+        options.gate = args.has("gate");
+        options.gateThreshold = args.getDouble("gate-threshold", 2.0);
+        options.gateMaxReuse = args.getInt("gate-max-reuse", 15);
+        job->pipeline.reset(new LanePipeline(options));
+        if (!config.output.empty()) {
+            job->output.addSink(std::unique_ptr<ResultSink>(new VideoSink( \
+                    config.output, args.getString("codec", "MJPG"), \
+                    args.getDouble("output-fps", 10), frameSize)));
+        }
+        if (!config.binary.empty()) {
+            job->output.addSink(std::unique_ptr<ResultSink>(new BinarySink( \
+                    config.binary, BinarySink::makeHeader(frameSize, \
+                            config.camParams, config.distCoeffs, \
+                            config.whiteMin, config.whiteMax, \
+                            config.yellowMin, config.yellowMax, \
+                            config.processScale))));
+        }
+        if (!config.results.empty() || \
+            (config.output.empty() && config.binary.empty())) {
+            std::string results = config.results.empty() ? \
+                    "../results/" + config.name + ".csv" : config.results;
+            job->output.addSink(std::unique_ptr<ResultSink>( \
+                    new CsvSink(results)));
+        }
+        if (scheduler)
+            job->output.start();
+        jobs.push_back(std::move(job));
+    }
+
+    // Every worker of the pool has a detection core of its own
+    cv::setNumThreads(0);
+    std::vector<int> cores;
+    int workers = args.getInt("threads", std::max(1, static_cast<int>( \
+                              std::thread::hardware_concurrency())));
+    if (scheduler) {
+        cores = scheduler->detection();
+        workers = args.getInt("threads", static_cast<int>(cores.size()));
+        scheduler->start();
+    }
+    int64 start = cv::getTickCount();
+    size_t steals = 0;
+    {
+        ThreadPool pool(workers, cores);
+        for (auto& job : jobs) {
+            StreamJob* stream = job.get();
+            pool.submit([&pool, stream] { processStream(pool, *stream); });
+        }
+        pool.wait();
+        steals = pool.steals();
+    }
+    double seconds = (cv::getTickCount() - start) / cv::getTickFrequency();
+
+    long total = 0;
+    for (auto& job : jobs) {
+        std::cout << job->config.name << ": " << job->pipeline->stream().frameCount() \
+                  << " frames from " << job->config.input << std::endl;
+        total += job->pipeline->stream().frameCount();
+    }
+    std::cout << jobs.size() << " streams, " << total << " frames in " \
+              << seconds << " s (" << (seconds > 0 ? total / seconds : 0) \
+              << " frames/s) on " << workers << " threads, " << steals \
+              << " steals" << std::endl;
+    if (scheduler)
+        scheduler->report(std::cout);
+    return 0;
+}
+
+/****************************************************************
+*
+*  @Brief: runRing() processes the frames which a local producer
+*          publishes into a shared memory frame ring. Every frame is
+*          handed to the library straight from its slot. When the
+*          producer has overwritten the slot by the time the
+*          detection is done, the result is discarded; all other
+*          results go to the result ring <ring>-results, with the
+*          frame sequence as frame index, and to --results.
+*
+****************************************************************/
+
+int runRing(const Arguments& args) {
+    std::string name = args.getString("ring", "");
+    FrameRing frames;
+    if (!frames.attach(name)) {
+        std::cout << "Error attaching to the frame ring: " << frames.error() \
+                  << std::endl;
+        return -1;
+    }
+    ResultRing results;
+    if (!results.create(name + "-results", static_cast<uint32_t>( \
+            std::max(1, args.getInt("ring-results", 256))))) {
+        std::cout << "Error creating the result ring: " << results.error() \
+                  << std::endl;
+        return -1;
+    }
+
+    LanePipeline::Options options;
+    if (!loadConfig(args, options.config))
+        return -1;
+    options.gate = args.has("gate");
+    options.gateThreshold = args.getDouble("gate-threshold", 2.0);
+    options.gateMaxReuse = args.getInt("gate-max-reuse", 15);
+    LanePipeline pipeline(options);
+
+    OutputWriter output;
+    if (args.has("results")) {
+        output.addSink(std::unique_ptr<ResultSink>(new CsvSink( \
+                       args.getString("results", \
+                                      "../results/LanesDetection.csv"))));
+    }
+
+    // The writer stays on the auxiliary cores and the detection loop with
+    // its OpenCV threads on the detection cores
+    std::unique_ptr<CoreScheduler> scheduler;
+    if (!makeScheduler(args, scheduler))
+        return -1;
+    if (scheduler) {
+        output.start();
+        CoreScheduler::pinCurrent(scheduler->detection());
+        cv::setNumThreads(scheduler->opencvThreads(false));
+        scheduler->start();
+    }
+
+    double timeout = args.getDouble("ring-timeout", 5.0);
+    FrameView view;
+    FrameRing::FrameInfo info;
+    long processed = 0;
+    int64 start = cv::getTickCount();
+    while (frames.next(view, info, timeout)) {
+        LaneResult result = pipeline.process(view);
+        if (!frames.intact(info.sequence))
+            continue;
+        result.frameIndex = static_cast<long>(info.sequence);
+        LaneRecord record = BinarySink::toRecord(result);
+        record.frameIndex = info.sequence;
+        results.publish(record, info.timestampNs);
+        output.push(cv::Mat(), result);
+        ++processed;
+    }
+    results.finish();
+    output.close();
+    double seconds = (cv::getTickCount() - start) / cv::getTickFrequency();
+
+    std::cout << processed << " frames in " << seconds << " s (" \
+              << (seconds > 0 ? processed / seconds : 0) << " frames/s), " \
+              << frames.dropped() << " dropped, " << frames.torn() \
+              << " overwritten while processed" << std::endl;
+    if (frames.timedOut())
+        std::cout << "No frame for " << timeout << " s, stopping" << std::endl;
+    if (scheduler)
+        scheduler->report(std::cout);
+    return 0;
+}
+
+//  Set by SIGINT and SIGTERM to end the daemon mode
+static volatile std::sig_atomic_t serveStopRequested = 0;
+
+static void requestServeStop(int) {
+    serveStopRequested = 1;
+}
+
+/****************************************************************
+*
+*  @Brief: runServer() is the daemon mode. The pipelines and the
+*          thread pool are set up once and then serve the jobs of
+*          any number of clients on a UNIX domain socket until the
+*          process is interrupted.
+*
+****************************************************************/
+
+int runServer(const Arguments& args) {
+    LaneServer::Options options;
+    options.socketPath = args.getString("serve", "/tmp/lanedetect.sock");
+    options.threads = args.getInt("threads", std::max(1, static_cast<int>( \
+                                  std::thread::hardware_concurrency())));
+    if (!loadConfig(args, options.pipeline.config))
+        return -1;
+    options.pipeline.gate = args.has("gate");
+    options.pipeline.gateThreshold = args.getDouble("gate-threshold", 2.0);
+    options.pipeline.gateMaxReuse = args.getInt("gate-max-reuse", 15);
+    options.ringTimeout = args.getDouble("ring-timeout", 5.0);
+    cv::setNumThreads(0);
+    std::unique_ptr<CoreScheduler> scheduler;
+    if (!makeScheduler(args, scheduler))
+        return -1;
+    if (scheduler) {
+        options.cores = scheduler->detection();
+        options.threads = args.getInt("threads", \
+                                      static_cast<int>(options.cores.size()));
+        scheduler->start();
+    }
 
+    LaneServer server(options);
+    if (!server.start()) {
+        std::cout << "Error starting the server: " << server.error() \
+                  << std::endl;
+        return -1;
+    }
+    std::signal(SIGINT, requestServeStop);
+    std::signal(SIGTERM, requestServeStop);
+    std::cout << "Serving on " << options.socketPath << " with " \
+              << options.threads << " threads" << std::endl;
+    while (!serveStopRequested)
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    server.stop();
+    std::cout << server.jobsDone() << " jobs for " \
+              << server.clientsServed() << " clients" << std::endl;
+    if (scheduler)
+        scheduler->report(std::cout);
+    return 0;
+}
 
+int main(int argc, char *argv[]) {
+    cv::Point p;
     //  Dummy variable for temporary points storage in HoughLines
     std::pair <cv::Point2d, cv::Point2d> vertices;
 
-    // Variable stores rho, theta from cv::HoughLines()
-    std::vector<cv::Vec2f> lines;
-
     //  Initialize the Files class as an object
     Files location;
 
@@ -92,231 +493,418 @@ int main(int argc, char *argv[]) {
     *
     ****************************************************************/
 
-    if (argc < 2) {
+    Arguments args(argc, argv);
+
+    //  Several cameras are processed together from a streams file
+    if (args.has("streams"))
+        return runStreams(args);
+
+    //  Jobs of many clients are served by one long-running process
+    if (args.has("serve"))
+        return runServer(args);
+
+    //  Frames published by a local producer are read from shared memory
+    if (args.has("ring"))
+        return runRing(args);
+
+    if (args.positional().size() < 1) {
         std::cout << "Please enter directory location in command prompt\n";
         std::getline(std::cin, fileAddress);
-        fileAddress = location.filePicker(fileAddress);
-    } else if (argc == 2) {
-        fileAddress = argv[1];
-        fileAddress = location.filePicker(fileAddress);
+    } else if (args.positional().size() == 1) {
+        fileAddress = args.positional().front();
     } else {
         std::cout << "The file path cannot contain empty spaces\n"
                   "please enter valid path without spaces.";
         std::getline(std::cin, fileAddress);
-        fileAddress = location.filePicker(fileAddress);
     }
 
-    cv::VideoCapture videofile(fileAddress);
-
-    if (!videofile.isOpened()) {
+    //  A directory of numbered image frames is read as an image sequence,
+    //  anything else has to be a video file. The directory is listed in the
+    //  background and decoding starts as soon as the first frames are known
+    if (FS::is_directory(fileAddress))
+        fileAddress = location.fileFeeder(fileAddress);
+    else
+        fileAddress = location.filePicker(fileAddress);
+    std::unique_ptr<CoreScheduler> scheduler;
+    if (!makeScheduler(args, scheduler))
+        return -1;
+    int decoders = std::max(1, static_cast<int>( \
+                   std::thread::hardware_concurrency()) - 1);
+    if (scheduler)
+        decoders = static_cast<int>(scheduler->auxiliary().size());
+    std::unique_ptr<FrameEnumerator> frameList;
+    std::unique_ptr<FrameSource> frameSource = openSource(fileAddress, args, \
+            args.getInt("decode-threads", decoders), frameList);
+
+    if (!frameSource->isOpened()) {
         std::cout << "Error opening input video file" << std::endl;
         return -1;
     }
 
-    int videoWidth = videofile.get(CV_CAP_PROP_FRAME_WIDTH);
-    int videoHeight = videofile.get(CV_CAP_PROP_FRAME_HEIGHT);
-
-    // Here we create a video writing object to write our output
-    cv::VideoWriter video("../results/LanesDetection.avi",
-                          CV_FOURCC('M', 'J', 'P', 'G'), 10,
-                          cv::Size(videoWidth, videoHeight));
-
-    while (1) {
-        lines.clear();   // Emptying the container from previous iteration
-        cv::Mat frame;
-
-        videofile >> frame;  //  <Grab the image frame
-
-        if (frame.empty())
-            break;
-        /*****************************************************************
-        *
-        *  To begin with, we grab the image frames and do pre-processing
-        *
-        ******************************************************************/
-
-        Cleaner imgClean((cv::Mat_<double>(3, 3) << 1.15422732e+03, \
-                          0.00000000e+00, 6.71627794e+02, 0.00000000e+00, \
-                          1.14818221e+03, 3.86046312e+02, 0.00000000e+00, \
-                          0.00000000e+00, 1.00000000e+00),  \
-                         (cv::Mat_<double>(1, 8) << -2.42565104e-01, \
-                          -4.77893070e-02, -1.31388084e-03, \
-                          -8.79107779e-05, 2.20573263e-02, 0, 0, 0));
-
-        imgClean.imgUndistort(frame);
-        cv::Mat blurImg;
-        blurImg = imgClean.imgSmoothen();
-
-        /***************************************************************
-        *
-        *    After pre-processing we mask the white and yellow lanes
-        *
-        ****************************************************************/
-
-        Thresholder lanethresh(cv::Scalar(198, 0, 0), \
-                               cv::Scalar(255, 255, 255), \
-                               cv::Scalar(165, 130, 130), \
-                               cv::Scalar(255, 255, 255));
-
-        cv::Mat labOutput;
-        labOutput = lanethresh.convertToLab(blurImg);
-
-        cv::Mat whiteOutput;
-        whiteOutput = lanethresh.whiteMaskFunc();
-
-        cv::Mat yellowOutput;
-        yellowOutput = lanethresh.yellowMaskFunc();
-
-        cv::Mat lanesMask;
-        lanesMask = lanethresh.combineLanes();
-        cv::imshow("Lanes Mask", lanesMask);
-
-        /****************************************************************
-        *
-        *  After masking the lanes we get rid of the unnecessary details
-        *  like horizon, trees, and other details on the sides of the
-        *  roads which can likely interfere with proper detection of lanes
-        *
-        *****************************************************************/
-
-        cv::Mat firstPolygonArea(lanesMask.rows, lanesMask.cols, \
-                                 CV_8U, cv::Scalar(0));
-        cv::Mat interestLanes = cv::Mat::zeros(lanesMask.size(), CV_8U);
-        cv::fillConvexPoly(firstPolygonArea, roiPoints, cv::Scalar(1));
-        lanesMask.copyTo(interestLanes, firstPolygonArea);
+    //  Decode the input once into a frame cache file for benchmarking
+    if (args.has("cache-frames")) {
+        std::string cachePath = args.getString("cache-frames", "");
+        std::string error;
+        long cached = FrameCacheSource::build(*frameSource, cachePath, error, \
+                                              args.has("yuv") ? PIXEL_NV12 : \
+                                                                -1);
+        frameSource->release();
+        if (cached < 0) {
+            std::cout << "Error caching frames: " << error << std::endl;
+            return -1;
+        }
+        std::cout << cached << " frames cached in " << cachePath << std::endl;
+        return 0;
+    }
 
-        /*****************************************************************
-        *
-        *   Later we employ a gradient based edge detector to detect
-        *   sharp edges which will be our lanes
-        *
-        ******************************************************************/
+    int videoWidth = frameSource->frameSize().width;
+    int videoHeight = frameSource->frameSize().height;
 
-        cv::Mat edges = cv::Mat::zeros(lanesMask.size(), CV_8U);
-        cv::Canny(interestLanes, edges, 15, 45, 3);
-        imshow("Canny Output", edges);
+    /****************************************************************
+    *
+    *  @Brief: The lane detection library does the work. The camera
+    *          calibration, the L*a*b thresholds and the screen area to
+    *          search for are those of the 1280x720 reference camera,
+    *          kept in normalized frame co-ordinates. The detection
+    *          itself may run on a downscaled frame.
+    *
+    *          The optional temporal coherence gate lets us skip the
+    *          whole detection chain when the region of interest has
+    *          not changed since the last processed frame, and on live
+    *          input the optional rate controller degrades the detection
+    *          quality step by step instead of falling behind the frame
+    *          rate of the source
+    *
+    ****************************************************************/
 
-        /******************************************************************
-        *
-        *  Later we strengthen the detected edges by drawinng Hough Lines
-        *  on top of their loci
-        *
-        *******************************************************************/
-
-        cv::HoughLines(edges, lines, 1, CV_PI / 180, 10, 0, 0);
-        LanesMarker lanesConsole;
-        lanesConsole.lanesSegregator(lines);
-        auto left = lanesConsole.leftLanesAverage();
-        auto right = lanesConsole.rightLanesAverage();
-        cv::Mat black_img = cv::Mat::zeros(labOutput.size(), \
-                                           labOutput.type());
-        cv::line(black_img, left.first, left.second, cv::Scalar(0, 0, 255), \
-                 3, cv::LINE_AA);
-        cv::line(black_img, right.first, right.second, cv::Scalar(0, 0, 255), \
-                 3, cv::LINE_AA);
-        imshow("Hough Output", black_img);
+    std::ofstream rateLogFile;
+    if (args.has("rate-log"))
+        rateLogFile.open(args.getString("rate-log", ""));
+    std::ostream& rateLog = rateLogFile.is_open() ? \
+                            static_cast<std::ostream&>(rateLogFile) : std::cout;
 
-        /*********************************************************************
-        *
-        *  Later we draw polygonal region on the road which denotes a region
-        *  within the bounds of two lanes in front of the vehicle
-        *
-        *********************************************************************/
+    LanePipeline::Options options;
+    if (!loadConfig(args, options.config))
+        return -1;
+    options.gate = args.has("gate");
+    options.gateThreshold = args.getDouble("gate-threshold", 2.0);
+    options.gateMaxReuse = args.getInt("gate-max-reuse", 15);
+    options.realtime = args.has("realtime");
+    options.targetFps = args.getDouble("target-fps", frameSource->fps());
+    options.rateLog = &rateLog;
+    LanePipeline pipeline(options);
+    const LaneConfig& config = options.config;
+
+    // The output files, in the order their sinks are added. The annotated
+    // video is written only when asked for with --output, otherwise the
+    // results go to a CSV file unless --binary is given
+    bool resultsOnly = args.has("results-only");
+    std::string videoPath, binaryPath, resultsPath;
+    std::vector<std::string> outputPaths;
+    if (args.has("output") && !resultsOnly) {
+        videoPath = args.getString("output", "../results/LanesDetection.avi");
+        outputPaths.push_back(videoPath);
+    }
+    if (args.has("binary")) {
+        binaryPath = args.getString("binary", \
+                                    "../results/LanesDetection.lres");
+        outputPaths.push_back(binaryPath);
+    }
+    if (args.has("results") || (videoPath.empty() && !args.has("binary"))) {
+        resultsPath = args.getString("results", \
+                                     "../results/LanesDetection.csv");
+        outputPaths.push_back(resultsPath);
+    }
 
-        cv::Mat polygonLayer = cv::Mat::zeros(labOutput.size(), \
-                                              labOutput.type());
-        cv::Mat linesCanny = polygonLayer.clone();
-        black_img.copyTo(polygonLayer, firstPolygonArea);
-        cv::Canny(polygonLayer, linesCanny, 70, 210, 3);
-        cv::Mat binaryRegions;
-        cv::findNonZero(linesCanny, binaryRegions);
-
-        RegionMaker polyMaker;
-        auto polyRegionVertices = polyMaker.getPolygonVertices(binaryRegions);
-        cv::Mat dummy = cv::Mat::zeros(labOutput.size(), labOutput.type());
-        for (auto& vertex : polyRegionVertices) {
-            if (vertex.x == 0 || vertex.y == 0) {
-                polyRegionVertices = historicLane;
-                break;
-            } else {}
+    // A job with --checkpoint continues from its last checkpoint, if any.
+    // --yuv frames give other lanes, so the format asked of the source is
+    // part of the settings a checkpoint is written with
+    int inputFormat = args.has("yuv") ? PIXEL_NV12 : -1;
+    uint64_t jobSettings = laneHash(&inputFormat, sizeof(inputFormat), \
+                                    pipeline.settingsHash());
+    std::string checkpointPath = args.getString("checkpoint", "");
+    long checkpointEvery = std::max(1, args.getInt("checkpoint-every", 900));
+    Checkpoint checkpoint;
+    bool resuming = !checkpointPath.empty() && FS::exists(checkpointPath);
+    if (resuming) {
+        std::string error;
+        if (!checkpoint.load(checkpointPath, error) || \
+            !checkpoint.matches(fileAddress, jobSettings, \
+                                outputPaths, error)) {
+            std::cout << "Error resuming from " << checkpointPath << ": " \
+                      << error << std::endl;
+            return -1;
         }
-        if (counter > 1 && ((std::abs(polyRegionVertices.at(2).x - \
-                                      historicLane.at(2).x) > 10) ||
-                            std::abs(polyRegionVertices.at(3).x - \
-                                     historicLane.at(3).x) > 10)) {
-            polyRegionVertices = historicLane;
+        if (checkpoint.complete) {
+            std::cout << "The job of " << checkpointPath \
+                      << " is complete" << std::endl;
+            return 0;
         }
+        if (frameSource->skip(checkpoint.frames) != checkpoint.frames) {
+            std::cout << "Error resuming from " << checkpointPath \
+                      << ": the input has less than " << checkpoint.frames \
+                      << " frames" << std::endl;
+            return -1;
+        }
+        pipeline.restore(checkpoint.pipeline);
+        std::cout << "Resuming at frame " << checkpoint.frames << std::endl;
+    }
 
-        historicLane = polyRegionVertices;
-
-        /*********************************************************************
-        *
-        *  Now we extrapolate our polygon to fill a desired area on screen
-        *
-        *********************************************************************/
+    // With --result-cache the lanes of a clip are looked up by its content,
+    // the detection settings and the engine version, and the processed
+    // chunks of frames are kept for the next job. Image directories and
+    // live input are not cached.
+    std::unique_ptr<ResultCache> resultCache;
+    std::string cacheKey;
+    long cachedFrames = -1;
+    uint64_t content = 0;
+    if (args.has("result-cache") && !options.realtime && \
+        ResultCache::contentHash(fileAddress, content)) {
+        uintmax_t capacity = static_cast<uintmax_t>(std::max(1, \
+                             args.getInt("result-cache-size", 1024))) << 20;
+        resultCache.reset(new ResultCache(args.getString("result-cache", \
+                          "../results/cache"), capacity));
+        cacheKey = resultCache->key(content, pipeline.settingsHash(), \
+                                    inputFormat);
+        cachedFrames = resultCache->frames(cacheKey);
+    }
 
-        auto newSlopeLeft = static_cast<float>(polyRegionVertices.at(0).y - \
-                                               polyRegionVertices.at(3).y) /
-                            static_cast<float>(polyRegionVertices.at(0).x - \
-                                               polyRegionVertices.at(3).x);
+    auto resumeAt = [&](size_t sink) -> long long {
+        return resuming ? checkpoint.outputs[sink].bytes : -1;
+    };
+
+    // Here we create the output writer, which encodes the annotated video
+    // and writes the per-frame lane results on its own thread. A resumed
+    // job continues the results files and starts a new video segment.
+    OutputWriter output;
+    if (!videoPath.empty()) {
+        output.addSink(std::unique_ptr<ResultSink>(new VideoSink( \
+                       resuming ? segmentPath(videoPath, checkpoint.frames) \
+                                : videoPath, \
+                       args.getString("codec", "MJPG"), \
+                       args.getDouble("output-fps", 10), \
+                       cv::Size(videoWidth, videoHeight))));
+    }
+    if (!binaryPath.empty()) {
+        size_t sink = videoPath.empty() ? 0 : 1;
+        output.addSink(std::unique_ptr<ResultSink>(new BinarySink( \
+                       binaryPath, \
+                       BinarySink::makeHeader( \
+                               cv::Size(videoWidth, videoHeight), \
+                               config.camParams, config.distCoeffs, \
+                               config.whiteMin, config.whiteMax, \
+                               config.yellowMin, config.yellowMax, \
+                               pipeline.stream().geometry(). \
+                               processScale()), resumeAt(sink))));
+    }
+    if (!resultsPath.empty()) {
+        output.addSink(std::unique_ptr<ResultSink>(new CsvSink( \
+                       resultsPath, resumeAt(outputPaths.size() - 1))));
+    }
 
-        auto newSlopeRight = static_cast<float>(polyRegionVertices.at(1).y - \
-                                                polyRegionVertices.at(2).y) /
-                             static_cast<float>(polyRegionVertices.at(1).x - \
-                                                polyRegionVertices.at(2).x);
+    // Benchmark runs leave out the windows and time only the detection.
+    // Otherwise the preview is drawn on its own thread, on a downscaled
+    // copy of at most --preview-fps frames a second.
+    bool benchmark = args.has("benchmark");
+    std::unique_ptr<PreviewRenderer> preview;
+    if (!benchmark) {
+        PreviewRenderer::Options previewOptions;
+        previewOptions.fps = args.getDouble("preview-fps", 10);
+        previewOptions.width = args.getInt("preview-width", 640);
+        previewOptions.debug = args.has("preview-debug");
+        preview.reset(new PreviewRenderer(previewOptions));
+    }
+    int64 detectTicks = 0;
+    long frameCount = 0;
+    if (resuming) {
+        frameCount = checkpoint.frames;
+        detectTicks = static_cast<int64>(checkpoint.detectSeconds * \
+                                         cv::getTickFrequency());
+    }
 
-        auto leftIntercept = static_cast<float>(polyRegionVertices.at(0).y) - \
-                             static_cast<float>(newSlopeLeft) * \
-                             static_cast<float>(polyRegionVertices.at(0).x);
+    // Frames answered by the result cache are only read from the source
+    // when the video needs them, so the source may lag behind frameCount
+    long sourceFrames = frameCount;
+    auto readFrame = [&](cv::Mat& frame) -> bool {
+        if (sourceFrames < frameCount)
+            sourceFrames += frameSource->skip(frameCount - sourceFrames);
+        if (sourceFrames != frameCount || !frameSource->read(frame))
+            return false;
+        sourceFrames++;
+        return true;
+    };
+
+    // A chunk is cached only when it was processed from its first frame
+    std::vector<LaneResult> chunkResults;
+    bool collecting = false;
+    long fromCache = 0;
+    auto storeChunk = [&]() {
+        if (collecting && !chunkResults.empty()) {
+            resultCache->store(cacheKey, frameCount - \
+                               static_cast<long>(chunkResults.size()), \
+                               chunkResults, pipeline.state());
+        }
+        chunkResults.clear();
+    };
+
+    // The checkpoint is written once the outputs of every frame read so
+    // far are on disk
+    auto saveCheckpoint = [&](bool complete) {
+        checkpoint.input = fileAddress;
+        checkpoint.settings = jobSettings;
+        checkpoint.frames = frameCount;
+        checkpoint.complete = complete;
+        checkpoint.detectSeconds = detectTicks / cv::getTickFrequency();
+        std::vector<long long> bytes = output.positions();
+        checkpoint.outputs.clear();
+        for (size_t i = 0; i < outputPaths.size(); i++) {
+            Checkpoint::Output file;
+            file.path = outputPaths[i];
+            file.bytes = bytes[i];
+            checkpoint.outputs.push_back(file);
+        }
+        checkpoint.pipeline = pipeline.state();
+        std::string error;
+        if (!checkpoint.save(checkpointPath, error))
+            std::cout << "Error writing the checkpoint: " << error << std::endl;
+    };
+
+    // The writer and the renderer are started on the auxiliary cores, then
+    // the detection thread moves to its own cores, where the OpenCV threads
+    // it starts run as well
+    if (scheduler) {
+        output.start();
+        CoreScheduler::pinCurrent(scheduler->detection());
+        cv::setNumThreads(scheduler->opencvThreads(false));
+        scheduler->start();
+    }
 
-        auto rightIntercept = static_cast<float>(polyRegionVertices.at(1).y) - \
-                              (static_cast<float>(newSlopeRight) * \
-                               static_cast<float>(polyRegionVertices.at(1).x));
+    bool finished = false;
+    while (1) {
+        cv::Mat frame;
 
-        polyRegionVertices.at(0).x = static_cast<double>((550 - \
-                                     leftIntercept) / newSlopeLeft);
-        polyRegionVertices.at(0).y = 550.0;
-        polyRegionVertices.at(1).x = static_cast<double>((550 - \
-                                     rightIntercept) / newSlopeRight);
-        polyRegionVertices.at(1).y = 550.0;
+        if (!checkpointPath.empty() && \
+            frameCount >= checkpoint.frames + checkpointEvery)
+            saveCheckpoint(false);
 
-        cv::fillConvexPoly(frame, polyRegionVertices, \
-                           cv::Scalar(0, 255, 0), CV_AA, 0);
+        if (frameCount == cachedFrames) {
+            finished = true;
+            break;
+        }
+        if (resultCache && frameCount % resultCache->chunk() == 0) {
+            storeChunk();
+            collecting = true;
+            std::vector<LaneResult> cached;
+            LanePipeline::State state;
+            if (resultCache->find(cacheKey, frameCount, cached, state)) {
+                bool read = true;
+                for (const LaneResult& result : cached) {
+                    cv::Mat image;
+                    if (output.needsFrame()) {
+                        read = readFrame(image);
+                        if (!read)
+                            break;
+                        image = LanePipeline::bgr(image, \
+                                                  frameSource->format());
+                        LaneStream::annotate(image, result);
+                    }
+                    output.push(image, result);
+                    frameCount++;
+                    fromCache++;
+                }
+                if (!read)
+                    break;
+                pipeline.restore(state);
+                continue;
+            }
+        }
 
-        double deviationLeft = std::abs(newSlopeLeft - 1);
+        if (!readFrame(frame)) {  //  <Grab the image frame
+            finished = true;
+            break;
+        }
 
-        double deviationRight = std::abs(newSlopeRight - 1);
+        // The frame is handed to the library without a copy
+        int format = frameSource->format();
+        int64 detectStart = cv::getTickCount();
+        LaneResult result = pipeline.process(LanePipeline::view(frame, \
+                                                                format));
+        detectTicks += cv::getTickCount() - detectStart;
+        frameCount++;
+        if (collecting)
+            chunkResults.push_back(result);
 
         /*********************************************************************
         *
-        *                   At the end we make turn predictions
+        *      At the end we mark the lanes and the turn prediction. The
+        *      renderer reads the frame it takes, so the video annotates a
+        *      copy of that one
         *
         *********************************************************************/
 
-        if (deviationRight > deviationLeft) {
-            cv::putText(frame, "Left turn ahead", cv::Point(30, 30),
-                        cv::FONT_HERSHEY_COMPLEX_SMALL, 0.8, \
-                        cv::Scalar(200, 200, 250), 1, CV_AA);
-        } else if (deviationRight < deviationLeft) {
-            cv::putText(frame, "Right turn ahead", cv::Point(30, 30),
-                        cv::FONT_HERSHEY_COMPLEX_SMALL, 0.8, \
-                        cv::Scalar(200, 200, 250), 1, CV_AA);
-        } else {}
-
-        video.write(frame);
-
-        cv::imshow("Final Lane Detection", frame);
-
-        counter++;
+        bool previewed = preview && preview->offer(frame, format, result, \
+            pipeline.detected() ? &pipeline.stream() : nullptr);
+        if (output.needsFrame()) {
+            cv::Mat annotated = LanePipeline::bgr(frame, format);
+            if (previewed && annotated.data == frame.data)
+                annotated = annotated.clone();
+            LaneStream::annotate(annotated, result);
+            frame = annotated;
+        }
+        output.push(frame, result);
 
-        char c = static_cast<char> (cv::waitKey(20));
-        if (c == 27)
+        if (preview && preview->closed())  //  <Esc in a preview window
             break;
     }
-    video.release();
-    videofile.release();
+    if (!checkpointPath.empty())
+        saveCheckpoint(finished);
+    if (resultCache) {
+        if (finished) {
+            storeChunk();
+            resultCache->complete(cacheKey, frameCount);
+        }
+        resultCache->evict();
+    }
+    if (preview)
+        preview->stop();
+    output.close();
+    frameSource->release();
+    if (benchmark) {
+        double seconds = detectTicks / cv::getTickFrequency();
+        std::cout << frameCount << " frames, detection " << seconds \
+                  << " s (" << (seconds > 0 ? frameCount / seconds : 0) \
+                  << " frames/s)" << std::endl;
+        if (resultCache)
+            std::cout << fromCache << " frames from the result cache" \
+                      << std::endl;
+    }
+    if (frameList && (frameList->skipped() > 0 || \
+                      frameList->outOfOrder() > 0)) {
+        std::cout << "Skipped " << frameList->skipped() \
+                  << " files which are not numbered images and " \
+                  << frameList->outOfOrder() \
+                  << " duplicate or out-of-order frames dropped" << std::endl;
+    }
+
+    // Export how many frames were short-circuited by the gate
+    if (pipeline.gate()) {
+        std::string statsAddress = args.getString("gate-stats", "");
+        if (statsAddress.empty()) {
+            pipeline.gate()->report(std::cout);
+        } else {
+            std::ofstream statsFile(statsAddress);
+            pipeline.gate()->report(statsFile);
+        }
+    }
+
+    // Export the time spent on every quality level
+    if (options.realtime)
+        pipeline.rate().report(rateLog);
 
-    cv::destroyAllWindows();
+    if (preview)
+        preview->report(std::cout);
+    if (scheduler)
+        scheduler->report(std::cout);
 
     return 0;
 }
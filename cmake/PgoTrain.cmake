@@ -0,0 +1,67 @@
+#Training run of the pgo-train target, invoked with cmake -P. It runs the
+#instrumented shell-app of APP_DIR over synthetic clips rendered by scene-gen
+#and over the recorded clips of CLIPS (separated by |), through both engines,
+#the gate, the band mode and the NV12 path, so the profiles cover the branches
+#a real drive takes. The profiles are written to PROFILE_DIR.
+
+file(REMOVE_RECURSE ${PROFILE_DIR})
+file(MAKE_DIRECTORY ${PROFILE_DIR} ${CLIP_DIR})
+#Clang writes one raw profile per process, GCC its counters to PGO_DIR
+set(ENV{LLVM_PROFILE_FILE} ${PROFILE_DIR}/lanes-%p.profraw)
+
+function(run)
+    execute_process(COMMAND ${ARGN} WORKING_DIRECTORY ${CLIP_DIR}
+                    RESULT_VARIABLE result OUTPUT_QUIET)
+    if (NOT result EQUAL 0)
+        string(REPLACE ";" " " command "${ARGN}")
+        message(FATAL_ERROR "Training run failed (${result}): ${command}")
+    endif()
+endfunction()
+
+#The scenes of the regression suite, at 60 frames each
+set(SCENES
+    "straight|--width=1280|--height=720|--noise=3|--seed=1"
+    "curve|--width=1280|--height=720|--curvature=0.06|--shadows=3|--noise=4|--seed=2"
+    "dashes|--width=1920|--height=1080|--left=dashed-white|--right=solid-white|--curvature=-0.04|--noise=2|--seed=3")
+set(INPUTS)
+foreach(scene ${SCENES})
+    string(REPLACE "|" ";" scene "${scene}")
+    list(GET scene 0 name)
+    list(REMOVE_AT scene 0)
+    message(STATUS "Rendering ${name}")
+    run(${APP_DIR}/scene-gen ${CLIP_DIR}/${name}.lraw --frames=60 ${scene})
+    list(APPEND INPUTS ${CLIP_DIR}/${name}.lraw)
+endforeach()
+run(${APP_DIR}/shell-app ${CLIP_DIR}/curve.lraw --yuv
+    --cache-frames=${CLIP_DIR}/curve_nv12.lraw)
+list(APPEND INPUTS ${CLIP_DIR}/curve_nv12.lraw)
+
+if (CLIPS)
+    string(REPLACE "|" ";" CLIPS "${CLIPS}")
+    foreach(clip ${CLIPS})
+        if (EXISTS ${clip})
+            list(APPEND INPUTS ${clip})
+        else()
+            message(STATUS "Skipping ${clip}, which does not exist")
+        endif()
+    endforeach()
+endif()
+
+set(index 0)
+foreach(input ${INPUTS})
+    message(STATUS "Training on ${input}")
+    foreach(options "--engine=hough" "--engine=window" "--gate|--band-rows")
+        string(REPLACE "|" ";" options "${options}")
+        math(EXPR index "${index} + 1")
+        run(${APP_DIR}/shell-app ${input} --benchmark --results-only
+            --results=${CLIP_DIR}/training${index}.csv ${options})
+    endforeach()
+endforeach()
+
+if (PROFDATA AND EXISTS "${PROFDATA}")
+    file(GLOB RAW_PROFILES ${PROFILE_DIR}/*.profraw)
+    if (RAW_PROFILES)
+        run(${PROFDATA} merge -output=${PROFILE_DIR}/lanes.profdata
+            ${RAW_PROFILES})
+    endif()
+endif()
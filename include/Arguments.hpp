@@ -0,0 +1,80 @@
+/************************************************************************************************
+* @file      : Header file for Arguments class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The Arguments class splits the command-line args into positional arguments
+*              (the input video path) and named options. Options are written either as
+*              bare flags (--gate) or as key value pairs (--gate-threshold=2.5)
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+
+class Arguments {
+ public:
+    /***
+    *@brief  : Default constructor for Arguments class
+    *@params : argc is the count of command-line args
+    *@params : argv is the array of command-line args
+    *****/
+    Arguments(int argc, char *argv[]);
+    ~Arguments() {}   // <Default destructor for Arguments class
+
+    /***
+    *@brief  : The has() function checks if an option was given by the user
+    *@params : key is the option name without the leading dashes
+    *****/
+    bool has(const std::string& key) const;
+
+    /***
+    *@brief  : The getString() function returns the value of an option
+    *@params : key is the option name without the leading dashes
+    *@params : fallback is the value returned when the option is absent
+    *****/
+    std::string getString(const std::string& key, \
+                          const std::string& fallback) const;
+
+    /***
+    *@brief  : The getDouble() function returns the numeric value of an option
+    *@params : key is the option name without the leading dashes
+    *@params : fallback is the value returned when the option is absent
+    *****/
+    double getDouble(const std::string& key, double fallback) const;
+
+    /***
+    *@brief  : The getInt() function returns the integer value of an option
+    *@params : key is the option name without the leading dashes
+    *@params : fallback is the value returned when the option is absent
+    *****/
+    int getInt(const std::string& key, int fallback) const;
+
+    /***
+    *@brief  : The positional() function returns all args which are not options
+    *****/
+    const std::vector<std::string>& positional() const;
+
+ private:
+    std::map<std::string, std::string> options;   // < Container for named options
+    std::vector<std::string> positionals;   // < Container for positional args
+};
@@ -0,0 +1,110 @@
+/************************************************************************************************
+* @file      : Header file for ChangeDetector class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ChangeDetector class is a cheap temporal coherence gate. It keeps a
+*              downsampled grayscale thumbnail of the region of interest from the last
+*              frame that went through the whole pipeline and compares every new raw
+*              frame against it with a mean sum of absolute differences (SAD). When the
+*              change is below a threshold the caller can skip Cleaner through
+*              RegionMaker and reuse the previous lane polygon. The number of back to
+*              back reuses is capped so that slow drifts are still picked up.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <iostream>
+#include <vector>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+class ChangeDetector {
+ public:
+    /***
+    *@brief  : Everything the gate carries from one frame to the next
+    *****/
+    struct State {
+        cv::Mat reference;   // < Thumbnail of the last fully processed frame
+        int reuseCount = 0;   // < Number of back to back reuses so far
+        long frames = 0;   // < Number of frames checked
+        long reused = 0;   // < Number of frames which reused the old result
+        double difference = 0;   // < Mean absolute difference of last check
+    };
+
+    /***
+    *@brief  : Default constructor for ChangeDetector class
+    *@params : roi is the region of interest polygon in frame co-ordinates
+    *@params : thresh is the mean absolute difference (in gray levels) below
+    *          which a frame is considered unchanged
+    *@params : maxReuse is the maximum number of consecutive frames which may
+    *          reuse the previous result
+    *@params : factor is the downsampling factor for the thumbnail
+    *****/
+    ChangeDetector(std::vector<cv::Point> roi, double thresh, int maxReuse, \
+                   int factor = 8) : roiPoints(roi), threshold(thresh), \
+                   reuseLimit(maxReuse), scaleFactor(factor) {}
+    ~ChangeDetector() {}   // <Default destructor for ChangeDetector class
+
+    /***
+    *@brief  : The isUnchanged() function tells whether the raw frame can reuse
+    *          the result of the last fully processed frame
+    *@params : rawImg is the input image frame before any processing
+    *@return : true if the previous lane result can be reused
+    *****/
+    bool isUnchanged(cv::Mat rawImg);
+
+    /***
+    *@brief  : The report() function writes the gating statistics
+    *@params : out is the stream on which the statistics are written
+    *****/
+    void report(std::ostream& out) const;
+
+    /***
+    *@brief  : The state() and restore() functions save and continue the gate
+    *          of a stream, such as for a checkpoint
+    *****/
+    State state() const;
+    void restore(const State& saved);
+
+    long framesSeen() const { return frames; }   // <Count of all frames
+    long framesReused() const { return reused; }   // <Count of reused frames
+    double lastDifference() const { return difference; }   // <Latest SAD
+
+ private:
+    /***
+    *@brief  : The makeThumbnail() function crops the region of interest out of
+    *          the raw frame, converts it to gray and downsamples it
+    *@params : rawImg is the input image frame before any processing
+    *****/
+    cv::Mat makeThumbnail(cv::Mat rawImg) const;
+
+    std::vector<cv::Point> roiPoints;   // < Region of interest polygon
+    double threshold;   // < Mean absolute difference threshold
+    int reuseLimit;   // < Maximum number of back to back reuses
+    int scaleFactor;   // < Downsampling factor for the thumbnail
+    cv::Mat reference;   // < Thumbnail of the last fully processed frame
+    int reuseCount = 0;   // < Number of back to back reuses so far
+    long frames = 0;   // < Number of frames checked
+    long reused = 0;   // < Number of frames which reused the old result
+    double difference = 0;   // < Mean absolute difference of the last check
+};
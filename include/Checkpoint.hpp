@@ -0,0 +1,91 @@
+/************************************************************************************************
+* @file      : Header file for Checkpoint class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The Checkpoint class records how far a batch job got: the input position, the lane
+*              history and gate of its pipeline, the size of every output file and the statistics, so
+*              that a restarted job continues where it stopped and writes the same outputs.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include "LanePipeline.hpp"
+
+class Checkpoint {
+ public:
+    /***
+    *@brief  : An output file and its size at the checkpoint
+    *****/
+    struct Output {
+        std::string path;   // < Location of the output file
+        long long bytes = -1;   // < File size, -1 if it cannot be continued
+    };
+
+    /***
+    *@brief  : Default constructor for Checkpoint class
+    *****/
+    Checkpoint() {}
+    ~Checkpoint() {}   // <Default destructor for Checkpoint class
+
+    /***
+    *@brief  : The save() function writes the checkpoint. The file is replaced
+    *          in one rename, so it always holds a complete checkpoint.
+    *@params : path is the location of the YAML checkpoint file
+    *@params : error receives the reason of a failure
+    *@return : false if the file cannot be written
+    *****/
+    bool save(const std::string& path, std::string& error) const;
+
+    /***
+    *@brief  : The load() function reads a checkpoint written by save()
+    *@params : path is the location of the YAML checkpoint file
+    *@params : error receives the reason of a failure
+    *@return : false if the file cannot be read or is malformed
+    *****/
+    bool load(const std::string& path, std::string& error);
+
+    /***
+    *@brief  : The matches() function tells whether the checkpoint belongs to
+    *          a job, so that a job never continues the outputs of another
+    *@params : source is the input of the job
+    *@params : settingsHash is the LanePipeline::settingsHash() of the job,
+    *          combined with anything else that changes its lanes
+    *@params : paths are the output files of the job, in sink order
+    *@params : error receives the first difference
+    *****/
+    bool matches(const std::string& source, uint64_t settingsHash, \
+                 const std::vector<std::string>& paths, \
+                 std::string& error) const;
+
+    std::string input;   // < Input of the job
+    uint64_t settings = 0;   // < Settings hash of the job, see matches()
+    long frames = 0;   // < Frames of the input read so far
+    bool complete = false;   // < Whether the job reached the end of input
+    std::vector<Output> outputs;   // < Output files in sink order
+    double detectSeconds = 0;   // < Time spent in the detection so far
+    LanePipeline::State pipeline;   // < Lane history and gate
+};
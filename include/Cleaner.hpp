@@ -5,7 +5,9 @@
 *              image frames:
 *                1.) Undistort the input image frame using camera parameters and distortion
 *                    coefficients; and
-*                2.) Smoothen the undistorted image using a gaussian filter.
+*                2.) Smoothen the undistorted image using a gaussian filter; and
+*                3.) Warp the road area into an undistorted top-down view with
+*                    a single remap.
 * @date      : October 8, 2018
 * @copyright : 2018, Arun Kumar Devarajulu
 * @license   : MIT License
@@ -42,6 +44,7 @@
 #include "opencv2/imgproc/imgproc_c.h"
 #include "opencv2/calib3d.hpp"
 #include "opencv2/imgcodecs.hpp"
+#include <vector>
 
 class Cleaner {
  public:
@@ -49,15 +52,19 @@ class Cleaner {
     * @brief  : The default constructor for Cleaner class
     * @params : cParam is the camera Parameters
     * @params : dCoeffs is the distortion coefficients
+    * @params : kernel is the size of the gaussian blur kernel
     *
     ****/
-    Cleaner(cv::Mat cParam, cv::Mat dCoeffs) : \
-        camParams(cParam), distCoeffs(dCoeffs) {}
+    Cleaner(cv::Mat cParam, cv::Mat dCoeffs, int kernel = 5) : \
+        camParams(cParam), distCoeffs(dCoeffs), kernelSize(kernel) {}
     ~Cleaner() {}   // <Default destructor for Cleaner class
 
     /**
     *
-    * @brief  : The function imgUndistort is used for undistorting an input image
+    * @brief  : The function imgUndistort is used for undistorting an input image.
+    *           The undistortion maps are computed on the first image and reused
+    *           for every following image of the same size, so one Cleaner
+    *           should be kept per video stream
     * @params : rawImg is the input image from video frames
     *
     ****/
@@ -70,10 +77,100 @@ class Cleaner {
     *****/
     cv::Mat imgSmoothen();
 
+    /***
+    *
+    * @brief  : the function getUndistorted returns the undistorted image without
+    *           any smoothing, for when the gaussian blur is skipped
+    *
+    *****/
+    cv::Mat getUndistorted() const { return undistortedImage; }
+
+    /***
+    *
+    * @brief  : the function prepareMaps builds the undistortion maps of an image
+    *           size unless they are built already
+    *
+    *****/
+    void prepareMaps(cv::Size size);
+
+    /***
+    *
+    * @brief  : the function remapRows undistorts a range of rows of an image
+    *           into dst. The maps of the image size must be prepared, and
+    *           the rows come out the same as those of imgUndistort
+    * @params : rawImg is the whole input image
+    * @params : first and last are the first row and one past the last row
+    *
+    *****/
+    void remapRows(const cv::Mat& rawImg, int first, int last, \
+                   cv::Mat& dst) const;
+
+    /***
+    *
+    * @brief  : the function smoothen applies the gaussian blur of imgSmoothen
+    *           to any image, such as a band of rows
+    *
+    *****/
+    void smoothen(const cv::Mat& src, cv::Mat& dst) const;
+
+    int kernel() const { return kernelSize; }   // <Gaussian blur kernel size
+
+    /***
+    *
+    * @brief  : the function setBirdsEye composes the undistortion and the
+    *           perspective transform of a road quadrilateral onto a top-down
+    *           view into one remap table
+    * @params : roadQuad are the top left, top right, bottom right and bottom
+    *           left corners of the road area in undistorted frame pixels
+    * @params : size is the size of the top-down view
+    *
+    *****/
+    void setBirdsEye(const std::vector<cv::Point2f>& roadQuad, cv::Size size);
+
+    /***
+    *
+    * @brief  : the function birdsEye remaps a raw image straight into the
+    *           undistorted top-down view of setBirdsEye
+    *
+    *****/
+    void birdsEye(const cv::Mat& rawImg, cv::Mat& view) const;
+
+    /***
+    *
+    * @brief  : the functions viewToFrame and frameToView map points between
+    *           the top-down view and the undistorted frame
+    *
+    *****/
+    std::vector<cv::Point2f> viewToFrame(\
+        const std::vector<cv::Point2f>& points) const;
+    std::vector<cv::Point2f> frameToView(\
+        const std::vector<cv::Point2f>& points) const;
+
+    /***
+    *
+    * @brief  : the function viewToFrame warps an image of the top-down view,
+    *           such as a lane mask, back onto an undistorted frame of a size
+    *
+    *****/
+    void viewToFrame(const cv::Mat& view, cv::Size frameSize, \
+                     cv::Mat& frame) const;
+
+    bool hasBirdsEye() const { return !viewMap1.empty(); }   // <View is set
+    cv::Size birdsEyeSize() const { return viewSize; }   // <Top-down size
+    cv::Mat viewHomography() const { return viewTransform; }   // <Frame to view
+
  private:
     cv::Mat camParams;   // < Container for Camera parameters
     cv::Mat distCoeffs;   // < Container for distortion coefficients
     cv::Mat rawImage;   // < Container for input image
     cv::Mat blurImage;   // < Container for denoised image
     cv::Mat undistortedImage;   // < Container for undistorted image
+    cv::Mat undistortMap1;   // < Fixed point source co-ordinates for cv::remap
+    cv::Mat undistortMap2;   // < Interpolation weights for cv::remap
+    cv::Size mapSize;   // < Image size the maps were computed for
+    cv::Mat viewMap1;   // < Composite source co-ordinates of the top-down view
+    cv::Mat viewMap2;   // < Composite interpolation weights of the view
+    cv::Mat viewTransform;   // < Homography from the undistorted frame to view
+    cv::Size viewSize;   // < Size of the top-down view
+    int kernelSize;   // < Size of the gaussian blur kernel
 };
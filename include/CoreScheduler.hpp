@@ -0,0 +1,108 @@
+/************************************************************************************************
+* @file      : Header file for CoreScheduler class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The CoreScheduler class splits a thread budget and a set of cores between the detection
+*              threads and the auxiliary threads of decoding, output and preview, pins threads to their
+*              cores, picks the OpenCV thread count and reports the utilization of every core.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <ostream>
+#include <string>
+#include <vector>
+
+class CoreScheduler {
+ public:
+    /***
+    *@brief  : Constructor for CoreScheduler class. The first cores of the set,
+    *          as many as the budget, are used: about a quarter of them, at
+    *          least one, for the auxiliary threads and the others for the
+    *          detection. A single core is shared by both.
+    *@params : cores is the core set, such as the result of available()
+    *@params : budget is the number of threads, 0 for one per core
+    *****/
+    CoreScheduler(const std::vector<int>& cores, int budget = 0);
+    ~CoreScheduler() {}   // <Default destructor for CoreScheduler class
+
+    /***
+    *@brief  : The parseCores() function reads a core list such as 0-3,8
+    *@params : text is the list of core numbers and ranges
+    *@params : cores receives the cores in ascending order
+    *@return : false if the list is malformed or empty
+    *****/
+    static bool parseCores(const std::string& text, std::vector<int>& cores);
+
+    /***
+    *@brief  : The available() function returns the cores the process may run
+    *          on, which taskset or a container may have narrowed down
+    *****/
+    static std::vector<int> available();
+
+    /***
+    *@brief  : The pinCurrent() function restricts the calling thread to a set
+    *          of cores. Threads started afterwards by the calling thread
+    *          inherit the set.
+    *@return : false if the affinity cannot be set
+    *****/
+    static bool pinCurrent(const std::vector<int>& cores);
+
+    /***
+    *@brief  : The detection() function returns the cores of the detection,
+    *          one per worker of a pool or, for a single input, those of the
+    *          OpenCV threads
+    *****/
+    const std::vector<int>& detection() const { return detectCores; }
+
+    /***
+    *@brief  : The auxiliary() function returns the cores of the decoding,
+    *          output, preview and socket threads
+    *****/
+    const std::vector<int>& auxiliary() const { return auxiliaryCores; }
+
+    /***
+    *@brief  : The opencvThreads() function returns the thread count for
+    *          cv::setNumThreads. A single input spreads its OpenCV calls over
+    *          the detection cores; with a pool every worker already has a
+    *          core, so OpenCV runs on the calling worker alone.
+    *@params : pooled tells whether the detection runs on a pool
+    *****/
+    int opencvThreads(bool pooled) const;
+
+    /***
+    *@brief  : The start() function samples the time of every core, from
+    *          which report() measures the utilization
+    *****/
+    void start();
+
+    /***
+    *@brief  : The report() function prints the share of time every core of
+    *          the set was busy since start(), from any process, and its role
+    *****/
+    void report(std::ostream& out) const;
+
+ private:
+    std::vector<int> detectCores;   // < Cores of the detection threads
+    std::vector<int> auxiliaryCores;   // < Cores of the other threads
+    std::vector<unsigned long long> busyStart;   // < Busy ticks at start()
+    std::vector<unsigned long long> totalStart;   // < All ticks at start()
+};
@@ -36,6 +36,7 @@
 *
 **************************************************************************************************/
 #pragma once
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <utility>
@@ -51,7 +52,7 @@ class Files {
     // @Brief: We create some short forms for long type names
 
     // Short form for file name pairs (for example, <200.jpg, 200>)
-    typedef std::pair<FS::path, int> file_entry;
+    typedef std::pair<FS::path, uint64_t> file_entry;
 
     // Short form for vector of tuples
     typedef std::vector<file_entry> vec;
@@ -72,17 +73,29 @@ class Files {
 
     // Next we create a string to integer conversion method that
     // sorts the numerical file names in ascending order.
-    // The return type for this method is "int"
-    int stringToInt(boost::filesystem::path const& pathObj);
+    // It returns false for files without a number
+    bool stringToInt(boost::filesystem::path const& pathObj, uint64_t& key);
+
+    // The frameKey method reads the frame number from a file name such as
+    // "200.jpg" or "frame_0200.png" (the last run of digits in the stem).
+    // It returns false for names without any digits or with a number
+    // beyond the range of uint64_t
+    static bool frameKey(const std::string& fileName, uint64_t& key);
+
+    // The isImageFile method accepts the image extensions read by the detector
+    // (jpg, jpeg, png, bmp, tif and tiff in any case) and rejects everything
+    // else, for example ".DS_Store" or "Thumbs.db"
+    static bool isImageFile(const std::string& fileName);
 
     // Next we create a path sorting method that sorts the path_vector
-    // into ascending order of files for accessing files in the right order
-    std::vector<std::pair<boost::filesystem::path, int>> \
+    // into ascending order of files for accessing files in the right order.
+    // Files which are not numbered images are left out
+    std::vector<std::pair<boost::filesystem::path, uint64_t>> \
             pathSorter(boost::filesystem::path const& boostPathObj);
 
  private:
-    // The path_vec vector is a vector of pairs <path, int>
-    std::vector<std::pair<boost::filesystem::path, int>> path_vec;
+    // The path_vec vector is a vector of pairs <path, uint64_t>
+    std::vector<std::pair<boost::filesystem::path, uint64_t>> path_vec;
     std::string dirAddress;   //< String object for storing valide dir address
     std::string fileAddress;   //< String object for storing valide file address
 };
@@ -0,0 +1,65 @@
+/************************************************************************************************
+* @file      : Raw decoded frame cache file layout
+* @author    : Arun Kumar Devarajulu
+* @brief     : A frame cache file holds the frames of a video exactly as the decoder produced them,
+*              so that benchmark runs read frames without decoding or copying them. The file starts
+*              with a FrameCacheHeader, the frames follow at page aligned offsets and a small index
+*              with one FrameCacheEntry per frame comes last. The frame count is written after the
+*              last frame, an interrupted file has none and is rejected. This header only needs the
+*              C++ standard library.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+// Magic bytes at the start of every frame cache file
+static const char kFrameCacheMagic[8] = {'L', 'A', 'N', 'E', 'R', 'A', 'W', '1'};
+// Version of the frame cache layout
+static const uint32_t kFrameCacheVersion = 1;
+// Every frame starts at a multiple of this offset
+static const uint64_t kFrameCacheAlignment = 4096;
+
+struct FrameCacheHeader {
+    char magic[8];   // < Always kFrameCacheMagic
+    uint32_t version;   // < Always kFrameCacheVersion
+    uint32_t headerSize;   // < Size of this header in bytes
+    uint32_t entrySize;   // < Size of one FrameCacheEntry in bytes
+    uint32_t width;   // < Frame width in pixels
+    uint32_t height;   // < Frame height in pixels
+    uint32_t format;   // < Pixel layout as a PixelFormat
+    uint32_t stride;   // < Bytes from one row to the next
+    uint32_t reserved0;   // < Padding, always zero
+    uint64_t frameCount;   // < Number of frames, zero until complete
+    uint64_t indexOffset;   // < File offset of the index
+    double fps;   // < Frame rate of the source, zero when unknown
+    uint8_t reserved[64];   // < Room for future fields, always zero
+};
+
+struct FrameCacheEntry {
+    uint64_t offset;   // < File offset of the frame
+    uint64_t sourceFrame;   // < Position of the frame in the source
+};
+
+static_assert(sizeof(FrameCacheHeader) == 128, "FrameCacheHeader must be 128 bytes");
+static_assert(sizeof(FrameCacheEntry) == 16, "FrameCacheEntry must be 16 bytes");
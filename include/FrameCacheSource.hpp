@@ -0,0 +1,103 @@
+/************************************************************************************************
+* @file      : Header file for FrameCacheSource class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The FrameCacheSource class reads a raw frame cache file as a frame source. The file is
+*              memory-mapped and every frame is handed out as a cv::Mat pointing into the mapping,
+*              so reading a frame neither decodes nor copies it. The mapping is private: drawing on
+*              a frame copies only the pages drawn on and never changes the file.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include "FrameCache.hpp"
+#include "FrameSource.hpp"
+
+class FrameCacheSource : public FrameSource {
+ public:
+    /***
+    *@brief  : Default constructor for FrameCacheSource class, maps the file
+    *@params : path is the location of the frame cache file
+    *****/
+    explicit FrameCacheSource(const std::string& path);
+    ~FrameCacheSource() { release(); }
+
+    bool isOpened() const override { return fileHeader != nullptr; }
+
+    /***
+    *@brief  : The read() function points frame at the next frame of the file.
+    *          The frame stays valid until the source is released.
+    *****/
+    bool read(cv::Mat& frame) override;
+    long skip(long count) override;
+    cv::Size frameSize() const override;
+    double fps() const override;
+    int format() const override;
+    void release() override;
+
+    /***
+    *@brief  : The rewind() function starts reading from a frame again, so that
+    *          benchmark runs can go over the same frames several times
+    *@params : position is the zero based frame position
+    *****/
+    void rewind(size_t position = 0) { nextFrame = position; }
+
+    size_t size() const { return frameCount; }   // <Frames in the file
+    const std::string& error() const { return lastError; }   // <Open failure
+
+    /***
+    *@brief  : The isCache() function tells whether a file starts like a frame
+    *          cache file
+    *@params : path is the location of the file
+    *****/
+    static bool isCache(const std::string& path);
+
+    /***
+    *@brief  : The build() function decodes every frame of a source once and
+    *          writes them to a frame cache file
+    *@params : source is the source to decode, read until its end
+    *@params : path is the location of the frame cache file
+    *@params : error receives the reason of a failure
+    *@params : format is PIXEL_NV12 to store BGR frames as NV12, -1 keeps the
+    *          frames as the source hands them out
+    *@return : The number of frames written, or -1 on failure
+    *****/
+    static long build(FrameSource& source, const std::string& path, \
+                      std::string& error, int format = -1);
+
+ private:
+    FrameCacheSource(const FrameCacheSource&) = delete;
+    FrameCacheSource& operator=(const FrameCacheSource&) = delete;
+
+    void *mapping = nullptr;   // < Start of the mapped file
+    size_t mappedBytes = 0;   // < Length of the mapping
+    const FrameCacheHeader *fileHeader = nullptr;   // < Mapped header
+    const FrameCacheEntry *entries = nullptr;   // < Mapped index
+    size_t frameCount = 0;   // < Number of frames
+    size_t nextFrame = 0;   // < Position read() returns next
+    std::string lastError;   // < Reason of the last failure
+};
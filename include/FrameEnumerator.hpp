@@ -0,0 +1,118 @@
+/************************************************************************************************
+* @file      : Header file for FrameEnumerator class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The FrameEnumerator class lists the numbered images of a directory on a
+*              background thread and hands out their paths in frame order. Entries are kept
+*              as compact (frame number, name offset) records over a single name buffer
+*              instead of one boost path per file, and frames are handed out as soon as the
+*              next frame number has been seen, so a directory with millions of frames does
+*              not have to be listed and sorted before the first frame is decoded.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class FrameEnumerator {
+ public:
+    /***
+    *@brief  : Default constructor for FrameEnumerator class, starts listing
+    *          the directory in the background
+    *@params : directory is the folder holding the numbered images
+    *@params : firstKey is the frame number the sequence starts with. Frames
+    *          are handed out before the listing ends only while the numbers
+    *          run on from firstKey without gaps, otherwise next() waits
+    *          for the complete listing.
+    *****/
+    explicit FrameEnumerator(const std::string& directory, \
+                             uint64_t firstKey = 0);
+    ~FrameEnumerator();   // < Stops the listing early and joins the thread
+
+    /***
+    *@brief  : The next() function waits until the next frame in order is known
+    *@params : path is filled with the full path of the next frame
+    *@return : false once every frame has been handed out
+    *****/
+    bool next(std::string& path);
+
+    size_t accepted() const;   // < Numbered images found so far
+    size_t skipped() const;   // < Directory entries which are not numbered images
+    size_t outOfOrder() const;   // < Duplicate or out-of-order frames dropped
+    bool finished() const;   // < True once the listing has ended
+
+    /***
+    *@brief  : The memoryBytes() function reports the memory held by the records
+    *          and the name buffer
+    *****/
+    size_t memoryBytes() const;
+
+ private:
+    /***
+    *@brief  : Record for one image, its name lives in the names buffer
+    *****/
+    struct Entry {
+        uint64_t key;   // < Frame number parsed from the file name
+        uint32_t nameOffset;   // < Start of the file name in the names buffer
+        uint32_t nameLength;   // < Length of the file name
+    };
+
+    /***
+    *@brief  : Orders the heap so that the smallest frame number is on top
+    *****/
+    struct Later {
+        bool operator()(const Entry& a, const Entry& b) const {
+            return a.key > b.key;
+        }
+    };
+
+    /***
+    *@brief  : The scan() function is the body of the listing thread, it moves
+    *          entries to the shared heap in batches
+    *****/
+    void scan();
+
+    /***
+    *@brief  : The merge() function adds a batch of entries under the lock
+    *****/
+    void merge(std::vector<Entry>& batch, std::string& batchNames);
+
+    std::string folder;   // < Directory being listed
+    std::string names;   // < File names of all the entries, back to back
+    std::vector<Entry> pending;   // < Min-heap of frames not handed out yet
+    uint64_t expected;   // < Frame number that may be handed out early
+    uint64_t lastKey = 0;   // < Frame number handed out last
+    bool started = false;   // < Set after the first frame was handed out
+    bool done = false;   // < Set when the listing has ended
+    std::atomic<bool> stopping{false};   // < Set to end the listing early
+    size_t acceptedCount = 0;
+    size_t skippedCount = 0;
+    size_t outOfOrderCount = 0;
+    mutable std::mutex listMutex;   // < Guards every member above
+    std::condition_variable listChanged;   // < Signalled after every batch
+    std::thread lister;   // < Listing thread
+};
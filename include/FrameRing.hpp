@@ -0,0 +1,136 @@
+/************************************************************************************************
+* @file      : Header file for FrameRing class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The FrameRing class is a single producer frame ring in POSIX shared memory. A capture
+*              process creates the ring and publishes frames into it without ever waiting, the
+*              detector attaches to it and reads every frame in place. A reader which falls more than
+*              the ring size behind skips the frames that were overwritten and counts them as dropped.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include "FrameView.hpp"
+#include "RingLayout.hpp"
+#include "SharedSegment.hpp"
+
+class FrameRing {
+ public:
+    struct FrameInfo {
+        uint64_t sequence = 0;   // < Frame sequence, starting at one
+        uint64_t timestampNs = 0;   // < Capture time in nanoseconds
+    };
+
+    FrameRing() {}   // <Default constructor
+    ~FrameRing();   // <Closes a created ring and unmaps the segment
+
+    /***
+    *@brief  : The create() function creates an empty ring as its producer
+    *@params : name is the shared memory name of the ring
+    *@params : slots is the number of frames the ring holds
+    *@params : slotBytes is the largest frame size in bytes
+    *@return : true if the ring was created
+    *****/
+    bool create(const std::string& name, uint32_t slots, uint32_t slotBytes);
+
+    /***
+    *@brief  : The claim() function marks the next slot busy and hands out its pixel
+    *          memory so that a producer can decode straight into the ring
+    *@params : width, height and format describe the frame, its rows are packed
+    *@return : The pixel memory of the slot, null if the frame does not fit
+    *****/
+    unsigned char *claim(int width, int height, int format);
+
+    /***
+    *@brief  : The commit() function publishes the frame written after claim()
+    *@params : timestampNs is the capture time of the frame
+    *****/
+    void commit(uint64_t timestampNs);
+
+    /***
+    *@brief  : The publish() function copies a frame into the next slot
+    *@params : frame is the frame to publish
+    *@params : timestampNs is the capture time of the frame
+    *@return : true if the frame fitted into a slot
+    *****/
+    bool publish(const FrameView& frame, uint64_t timestampNs);
+
+    /***
+    *@brief  : The finish() function tells the readers that no frame follows
+    *****/
+    void finish();
+
+    /***
+    *@brief  : The attach() function attaches to a ring as its reader and starts at
+    *          the oldest frame the ring still holds
+    *@params : name is the shared memory name of the ring
+    *@return : true if the segment exists and holds a frame ring
+    *****/
+    bool attach(const std::string& name);
+
+    /***
+    *@brief  : The next() function waits for the next frame and points the view at
+    *          its slot. The view stays valid until the producer wraps around, which
+    *          intact() tells after the frame was used.
+    *@params : frame receives the view of the slot
+    *@params : info receives the sequence and the capture time
+    *@params : timeoutSeconds is how long to wait for a new frame
+    *@return : false once the ring is finished and read or on a timeout
+    *****/
+    bool next(FrameView& frame, FrameInfo& info, double timeoutSeconds);
+
+    /***
+    *@brief  : The intact() function checks that a frame handed out by next() was
+    *          not overwritten while it was used, and counts it as torn otherwise
+    *@params : sequence is the sequence of the frame
+    *@return : true if the slot still holds the frame
+    *****/
+    bool intact(uint64_t sequence);
+
+    uint32_t slotCount() const { return header ? header->slotCount : 0; }   // <Ring size
+    uint64_t published() const;   // <Sequence of the newest frame
+    uint64_t dropped() const { return droppedFrames; }   // <Frames skipped by next()
+    uint64_t torn() const { return tornFrames; }   // <Frames failing intact()
+    bool timedOut() const { return waitTimedOut; }   // <Whether next() gave up waiting
+    const std::string& error() const { return lastError; }   // <Last failure
+
+ private:
+    FrameRing(const FrameRing&) = delete;
+    FrameRing& operator=(const FrameRing&) = delete;
+
+    /***
+    *@brief  : The slotAt() function returns the slot of a sequence number
+    *****/
+    FrameSlot *slotAt(uint64_t sequence) const;
+
+    SharedSegment segment;   // < Mapping of the ring
+    FrameRingHeader *header = nullptr;   // < Start of the mapping
+    bool producer = false;   // < Whether this side created the ring
+    uint64_t claimed = 0;   // < Sequence of the slot handed out by claim()
+    uint64_t nextSequence = 1;   // < Sequence next() reads next
+    uint64_t droppedFrames = 0;   // < Frames skipped by next()
+    uint64_t tornFrames = 0;   // < Frames failing intact()
+    bool waitTimedOut = false;   // < Whether next() gave up waiting
+    std::string lastError;   // < Description of the last failure
+};
@@ -0,0 +1,107 @@
+/************************************************************************************************
+* @file      : Header file for FrameSource classes
+* @author    : Arun Kumar Devarajulu
+* @brief     : A FrameSource hands the input frames to the detection loop one by one in
+*              order, independent of where they come from. The VideoSource reads a
+*              video file through cv::VideoCapture.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <string>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+
+class FrameSource {
+ public:
+    virtual ~FrameSource() {}   // <Default destructor for FrameSource class
+
+    /***
+    *@brief  : The isOpened() function tells whether the source can be read
+    *****/
+    virtual bool isOpened() const = 0;
+
+    /***
+    *@brief  : The read() function grabs the next frame
+    *@params : frame is the container for the next frame
+    *@return : false once the source has no more frames
+    *****/
+    virtual bool read(cv::Mat& frame) = 0;
+
+    /***
+    *@brief  : The frameSize() function returns the size of the frames
+    *****/
+    virtual cv::Size frameSize() const = 0;
+
+    /***
+    *@brief  : The fps() function returns the frame rate of the source, or zero
+    *          when the source does not know it
+    *****/
+    virtual double fps() const = 0;
+
+    /***
+    *@brief  : The format() function returns the PixelFormat of the frames
+    *          read, or -1 when the channels of a frame tell its format
+    *****/
+    virtual int format() const { return -1; }
+
+    /***
+    *@brief  : The skip() function moves past frames without handing them
+    *          out, so that a resumed job continues where it stopped. The
+    *          default reads and drops them.
+    *@params : count is the number of frames to skip
+    *@return : The number of frames skipped, less than count at the end
+    *****/
+    virtual long skip(long count);
+
+    /***
+    *@brief  : The release() function closes the source
+    *****/
+    virtual void release() = 0;
+};
+
+class VideoSource : public FrameSource {
+ public:
+    /***
+    *@brief  : Default constructor for VideoSource class
+    *@params : path is the location of the input video file
+    *@params : yuv asks the capture backend for its decoded frames without the
+    *          conversion to BGR
+    *****/
+    explicit VideoSource(const std::string& path, bool yuv = false);
+    ~VideoSource() { release(); }
+
+    bool isOpened() const override { return videofile.isOpened(); }
+    bool read(cv::Mat& frame) override;
+    long skip(long count) override;
+    cv::Size frameSize() const override;
+    double fps() const override;
+    int format() const override { return frameFormat; }
+    void release() override { videofile.release(); }
+
+ private:
+    cv::VideoCapture videofile;   // < Video reading object
+    bool rawFrames;   // < Whether the BGR conversion is switched off
+    int frameFormat = -1;   // < PixelFormat of the last frame read
+};
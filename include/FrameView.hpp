@@ -0,0 +1,78 @@
+/************************************************************************************************
+* @file      : Header file for the caller-owned frame view
+* @author    : Arun Kumar Devarajulu
+* @brief     : The FrameView structure describes a frame which lives in memory owned by the
+*              caller, for example a camera driver buffer: a pointer to the first pixel, the
+*              number of bytes between the starts of two rows, the size and the pixel layout.
+*              LanePipeline::process() reads the pixels in place, the frame is never copied
+*              into a cv::Mat of its own.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <cstddef>
+
+// Pixel layouts a FrameView can describe, 8 bits per channel
+enum PixelFormat {
+    PIXEL_BGR = 0,   // < Blue, green, red, as decoded by OpenCV
+    PIXEL_RGB = 1,   // < Red, green, blue
+    PIXEL_BGRA = 2,   // < Blue, green, red, alpha
+    PIXEL_RGBA = 3,   // < Red, green, blue, alpha
+    PIXEL_GRAY = 4,   // < Single luminance channel
+    PIXEL_NV12 = 5   // < Luminance plane followed by interleaved U, V
+                     //   at half the width and height
+};
+
+struct FrameView {
+    const unsigned char* data = nullptr;   // < First pixel of the frame
+    size_t stride = 0;   // < Bytes from one row to the next
+    int width = 0;   // < Frame width in pixels
+    int height = 0;   // < Frame height in pixels, of the image and not
+                      //   the rows of its planes
+    int format = PIXEL_BGR;   // < Pixel layout as a PixelFormat
+};
+
+/***
+*@brief  : The pixelBytes() function returns the bytes per pixel of a format,
+*          for planar formats those of a row of the luminance plane
+*@return : The bytes per pixel, zero for an unknown format
+*****/
+inline int pixelBytes(int format) {
+    switch (format) {
+        case PIXEL_BGR: case PIXEL_RGB: return 3;
+        case PIXEL_BGRA: case PIXEL_RGBA: return 4;
+        case PIXEL_GRAY: case PIXEL_NV12: return 1;
+        default: return 0;
+    }
+}
+
+/***
+*@brief  : The planeRows() function returns the rows of stride bytes a frame of
+*          a format occupies. The chroma rows of NV12 follow its luminance
+*          rows, so an NV12 frame needs an even height.
+*@return : The rows of all planes, zero for an odd NV12 height
+*****/
+inline int planeRows(int format, int height) {
+    if (format != PIXEL_NV12)
+        return height;
+    return height % 2 == 0 ? height / 2 * 3 : 0;
+}
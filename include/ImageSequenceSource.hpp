@@ -0,0 +1,98 @@
+/************************************************************************************************
+* @file      : Header file for ImageSequenceSource class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ImageSequenceSource class reads a directory of numbered image frames
+*              (handed out in order by a FrameEnumerator) as an input. A pool of workers decodes the
+*              images with cv::imread ahead of the detector into a bounded reorder
+*              buffer, so that the detector sees strictly ordered frames and does not
+*              wait on JPEG decoding as long as the workers keep up. The buffer holds at
+*              most a fixed number of frames ahead of the detector, which bounds the
+*              memory used by the prefetching.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include "FrameSource.hpp"
+
+class ImageSequenceSource : public FrameSource {
+ public:
+    // Short form for the function handing out image files in frame order,
+    // it returns false after the last file
+    typedef std::function<bool(std::string&)> PathFeed;
+
+    /***
+    *@brief  : Default constructor for ImageSequenceSource class
+    *@params : feed hands out the image files in frame order, it may block
+    *          while the files are still being listed
+    *@params : workers is the number of decoding threads
+    *@params : rate is the frame rate reported for the sequence
+    *@params : window is the number of frames decoded ahead of the detector,
+    *          zero picks twice the number of workers
+    *****/
+    ImageSequenceSource(PathFeed feed, int workers, double rate, \
+                        size_t window = 0);
+
+    /***
+    *@brief  : Constructor for a list of image files known up front
+    *@params : paths are the image files in frame order
+    *****/
+    ImageSequenceSource(const std::vector<std::string>& paths, int workers, \
+                        double rate, size_t window = 0);
+    ~ImageSequenceSource() { release(); }
+
+    bool isOpened() const override { return !firstSize.empty(); }
+    bool read(cv::Mat& frame) override;
+    cv::Size frameSize() const override { return firstSize; }
+    double fps() const override { return frameRate; }
+    void release() override;
+
+ private:
+    /***
+    *@brief  : The decode() function is the body of every decoding thread
+    *****/
+    void decode();
+
+    PathFeed nextPath;   // < Hands out the image files in frame order
+    double frameRate;   // < Frame rate reported for the sequence
+    cv::Size firstSize;   // < Size of the first frame
+    std::vector<cv::Mat> slots;   // < Reorder buffer indexed by frame % size
+    std::vector<char> ready;   // < Marks decoded slots
+    size_t nextDecode = 0;   // < Next frame to hand to a worker
+    size_t nextRead = 0;   // < Next frame to hand to the detector
+    size_t total;   // < Number of frames, known once the feed runs dry
+    bool exhausted = false;   // < Set when the feed has run dry
+    bool stopping = false;   // < Set when the workers must exit
+    std::mutex claimMutex;   // < Guards the feed, nextDecode and exhausted
+    std::mutex bufferMutex;   // < Guards the buffer and the other counters
+    std::condition_variable slotFree;   // < Signalled when a slot frees up
+    std::condition_variable slotReady;   // < Signalled when a frame is decoded
+    std::vector<std::thread> pool;   // < Decoding threads
+};
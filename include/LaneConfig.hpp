@@ -0,0 +1,130 @@
+/************************************************************************************************
+* @file      : Header file for LaneConfig class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneConfig structure holds everything that differs between the cameras of
+*              a vehicle: the camera calibration, the region of interest, the color thresholds,
+*              the processing scale and where the results of the stream go. The defaults are
+*              the values the pipeline was tuned with on the 1280x720 reference footage. A
+*              configuration is read from a cv::FileStorage node (YAML or XML), and a streams
+*              file lists one such node per camera for the multi-stream mode.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+
+// Lane fitting engines of the detection chain
+enum LaneEngine {
+    ENGINE_HOUGH = 0,   // < Canny, HoughLines and the polygon search
+    ENGINE_WINDOW = 1   // < Sliding windows on a top-down view
+};
+
+struct LaneConfig {
+    /***
+    *@brief  : Default constructor for LaneConfig, fills in the reference camera
+    *****/
+    LaneConfig();
+
+    /***
+    *@brief  : The read() function overrides the settings present in a node.
+    *          The keys are name, input, output, results, binary, camera_matrix,
+    *          distortion, calibration_size, white_min, white_max, yellow_min,
+    *          yellow_max, roi (normalized x, y pairs), process_scale,
+    *          gauss_kernel, canny, polygon_canny (low, high pairs),
+    *          hough_rho, hough_theta (degrees), hough_threshold,
+    *          band_rows, engine (hough or window), birds_eye (four
+    *          normalized x, y pairs) and view_size
+    *@params : node is a map node of a cv::FileStorage
+    *@params : error receives a description of the first malformed key
+    *@return : false if a key is malformed
+    *****/
+    bool read(const cv::FileNode& node, std::string& error);
+
+    /***
+    *@brief  : The loadStreams() function reads a file with a "streams" sequence
+    *          holding one configuration per camera
+    *@params : path is the YAML or XML file
+    *@params : error receives a description of the first problem
+    *@params : base holds the settings of the keys a stream leaves out
+    *@return : The configurations in file order, empty on error
+    *****/
+    static std::vector<LaneConfig> loadStreams(const std::string& path, \
+                                               std::string& error, \
+                                               const LaneConfig& base = \
+                                               LaneConfig());
+
+    /***
+    *@brief  : The loadFile() function overrides the settings present at the
+    *          top level of a file, such as the output of lane-tune
+    *@params : path is the YAML or XML file
+    *@params : error receives a description of the first problem
+    *@return : false if the file cannot be read or a key is malformed
+    *****/
+    bool loadFile(const std::string& path, std::string& error);
+
+    /***
+    *@brief  : The engineFromName() function looks up a LaneEngine by name
+    *@return : false if there is no engine of that name
+    *****/
+    static bool engineFromName(const std::string& text, int& value);
+
+    /***
+    *@brief  : The settingsHash() function hashes every setting which changes
+    *          the detected lanes: the calibration, the thresholds, the region
+    *          and the chain settings. The names, files and band rows, which
+    *          give bit-identical masks, are left out.
+    *@return : A 64 bit hash, equal for settings which detect the same lanes
+    *****/
+    uint64_t settingsHash() const;
+
+    std::string name;   // < Name used in reports and default file names
+    std::string input;   // < Video file or directory of numbered frames
+    std::string output;   // < Annotated video file, empty for none
+    std::string results;   // < CSV results file, empty for none
+    std::string binary;   // < Binary results file, empty for none
+    cv::Mat camParams;   // < 3x3 camera matrix
+    cv::Mat distCoeffs;   // < Distortion coefficients
+    cv::Size calibrationSize;   // < Resolution the camera matrix belongs to
+    cv::Scalar whiteMin;   // < Minimum L*a*b threshold for white lanes
+    cv::Scalar whiteMax;   // < Maximum L*a*b threshold for white lanes
+    cv::Scalar yellowMin;   // < Minimum L*a*b threshold for yellow lanes
+    cv::Scalar yellowMax;   // < Maximum L*a*b threshold for yellow lanes
+    std::vector<cv::Point2d> roi;   // < Normalized region, empty for default
+    double processScale;   // < Processing scale in the range (0, 1]
+    int gaussKernel;   // < Gaussian blur kernel size, below 3 for no blur
+    double cannyLow, cannyHigh;   // < Canny thresholds of the lane mask
+    double polygonCannyLow, polygonCannyHigh;   // < Canny of the lane lines
+    double houghRho;   // < HoughLines distance resolution in pixels
+    double houghTheta;   // < HoughLines angle resolution in radians
+    int houghThreshold;   // < HoughLines accumulator threshold
+    int bandRows;   // < Rows per band of the per-pixel stages, 0 for whole
+                    //   frames and below 0 for bands sized to the L2 cache
+    int engine;   // < Lane fitting engine as a LaneEngine
+    std::vector<cv::Point2d> birdsEye;   // < Normalized road corners of the
+                                         //   top-down view, empty for roi
+    cv::Size viewSize;   // < Top-down view size at the calibration size
+};
@@ -0,0 +1,141 @@
+/************************************************************************************************
+* @file      : Header file for the sliding window lane fitter
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneFitter class finds the two lanes of a top-down binary lane mask. The lane
+*              bases come from a column histogram of the lower rows, sliding windows follow each lane
+*              upwards, and a second order polynomial is fitted to the lane pixels by least squares.
+*              Once both lanes are tracked only the pixels near the previous fits are searched.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <vector>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+class LaneFitter {
+ public:
+    /***
+    *@brief  : Settings of the lane search
+    *****/
+    struct Options {
+        int windows = 9;   // < Sliding windows stacked over the view height
+        double margin = 1.0 / 12;   // < Half window width as a fraction of the
+                                    //   view width, also the tracking margin
+        int recenterPixels = 20;   // < Pixels in a window which move the next
+        int fitPixels = 60;   // < Pixels a lane needs for a polynomial fit
+        double histogramRows = 0.5;   // < Lower fraction of rows in the
+                                      //   column histogram
+    };
+
+    /***
+    *@brief  : Default constructor for LaneFitter class
+    *****/
+    LaneFitter() {}
+    explicit LaneFitter(const Options& settings) : options(settings) {}
+    ~LaneFitter() {}   // <Default destructor for LaneFitter class
+
+    /***
+    *@brief  : The fit() function fits both lanes of a mask. Every call is the
+    *          next frame of a stream: with both lanes tracked only a margin
+    *          around the previous fits is searched, and the sliding windows
+    *          are only used when that fails
+    *@params : mask is the CV_8U top-down lane mask, non-zero on lane pixels
+    *@return : true if both lanes were fitted, the fits of the last frame are
+    *          kept otherwise
+    *****/
+    bool fit(const cv::Mat& mask);
+
+    /***
+    *@brief  : The reset() function forgets the tracked lanes, so that the
+    *          next frame starts with the sliding windows
+    *****/
+    void reset() { tracked = false; }
+
+    /***
+    *@brief  : The restore() function continues tracking from saved fits,
+    *          those of left(), right() and tracking() at a checkpoint
+    *****/
+    void restore(const cv::Vec3d& left, const cv::Vec3d& right, \
+                 bool tracking) {
+        leftFit = left;
+        rightFit = right;
+        tracked = tracking;
+    }
+
+    /***
+    *@brief  : The evaluate() function returns the column of a fit at a row
+    *@params : coeffs are a, b and c of x = a * y^2 + b * y + c
+    *****/
+    static double evaluate(const cv::Vec3d& coeffs, double row) {
+        return (coeffs[0] * row + coeffs[1]) * row + coeffs[2];
+    }
+
+    /***
+    *@brief  : The fitPolynomial() function fits x = a * y^2 + b * y + c to
+    *          pixels by least squares
+    *@return : false if the pixels do not determine the three coefficients
+    *****/
+    static bool fitPolynomial(const std::vector<cv::Point>& pixels, \
+                              cv::Vec3d& coeffs);
+
+    const cv::Vec3d& left() const { return leftFit; }   // <Left lane fit
+    const cv::Vec3d& right() const { return rightFit; }   // <Right lane fit
+    bool tracking() const { return tracked; }   // <Lanes of last frame kept
+    bool searched() const { return usedWindows; }   // <Last fit used windows
+    size_t lanePixels() const { return pixelCount; }   // <Pixels fitted
+
+ private:
+    /***
+    *@brief  : The slidingWindows() function finds the lane bases from the
+    *          column histogram and collects the pixels of each lane window by
+    *          window from the bottom of the view to the top
+    *****/
+    void slidingWindows(const cv::Mat& mask, \
+                        const std::vector<cv::Point>& pixels, \
+                        std::vector<cv::Point>& leftPixels, \
+                        std::vector<cv::Point>& rightPixels) const;
+
+    /***
+    *@brief  : The searchAround() function collects the pixels within the
+    *          margin of the previous fits
+    *****/
+    void searchAround(const std::vector<cv::Point>& pixels, int margin, \
+                      std::vector<cv::Point>& leftPixels, \
+                      std::vector<cv::Point>& rightPixels) const;
+
+    /***
+    *@brief  : The accept() function fits both lanes and checks that the left
+    *          lane stays left of the right lane over the whole view
+    *****/
+    bool accept(const std::vector<cv::Point>& leftPixels, \
+                const std::vector<cv::Point>& rightPixels, int rows);
+
+    Options options;   // < Settings of the lane search
+    cv::Vec3d leftFit;   // < Left lane fit of the last fitted frame
+    cv::Vec3d rightFit;   // < Right lane fit of the last fitted frame
+    bool tracked = false;   // < Whether the last frame fitted both lanes
+    bool usedWindows = false;   // < Whether the last fit used the windows
+    size_t pixelCount = 0;   // < Lane pixels of the last fit
+};
@@ -0,0 +1,109 @@
+/************************************************************************************************
+* @file      : Header file for LaneGeometry class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneGeometry class keeps every frame dependent constant of the lane
+*              detection pipeline (region of interest, polygon rows, horizon row, Hough
+*              line extrapolation length) in normalized frame co-ordinates, so that the
+*              pipeline works on any input resolution. It also owns the processing scale
+*              used for running the detection on a downscaled (pyrDown) copy of the frame
+*              and maps the lane geometry back to the full resolution frame
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <vector>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+class LaneGeometry {
+ public:
+    /***
+    *@brief  : Default constructor for LaneGeometry class. The normalized constants
+    *          are derived from the 1280x720 reference footage the pipeline was
+    *          originally tuned on
+    *@params : procScale is the processing scale in the range (0, 1], where 1 means
+    *          that the detection runs on the full resolution frame
+    *****/
+    explicit LaneGeometry(double procScale = 1.0);
+
+    /***
+    *@brief  : Constructor for a camera with its own region of interest
+    *@params : procScale is the processing scale in the range (0, 1]
+    *@params : roi are the region of interest corners as fractions of the frame
+    *          width and height, an empty vector keeps the default region
+    *@params : calibration is the resolution the camera matrix is calibrated on
+    *****/
+    LaneGeometry(double procScale, const std::vector<cv::Point2d>& roi, \
+                 cv::Size calibration);
+    ~LaneGeometry() {}   // <Default destructor for LaneGeometry class
+
+    /***
+    *@brief  : The downscale() function shrinks the raw frame to the processing scale
+    *@params : rawImg is the full resolution input image frame
+    *@return : The image frame on which the detection runs
+    *****/
+    cv::Mat downscale(cv::Mat rawImg) const;
+
+    /***
+    *@brief  : The toFrame() function maps points from the processing image back
+    *          onto the full resolution frame
+    *@params : points are the points in processing image co-ordinates
+    *@params : from is the size of the processing image
+    *@params : to is the size of the full resolution frame
+    *****/
+    std::vector<cv::Point> toFrame(const std::vector<cv::Point>& points, \
+                                   cv::Size from, cv::Size to) const;
+    cv::Point2d toFrame(cv::Point2d point, cv::Size from, cv::Size to) const;
+
+    /***
+    *@brief  : The roiPolygon() function returns the region of interest corners
+    *@params : frame is the size of the image the polygon is used on
+    *****/
+    std::vector<cv::Point> roiPolygon(cv::Size frame) const;
+
+    /***
+    *@brief  : The cameraMatrix() function rescales the camera parameters, which are
+    *          calibrated on the reference resolution, to the given image size
+    *@params : camParams is the 3x3 camera matrix for the reference resolution
+    *@params : frame is the size of the image the camera matrix is used on
+    *****/
+    cv::Mat cameraMatrix(cv::Mat camParams, cv::Size frame) const;
+
+    int polygonTopRow(cv::Size frame) const;   // <Upper row of lane polygon
+    int polygonBottomRow(cv::Size frame) const;   // <Lower row of lane polygon
+    int horizonRow(cv::Size frame) const;   // <Row the polygon is extended to
+    double lineExtent(cv::Size frame) const;   // <Hough lines half length
+    int jumpTolerance(cv::Size frame) const;   // <Allowed polygon jump
+    double processScale() const { return scale; }   // <Processing scale
+
+ private:
+    double scale;   // < Processing scale in the range (0, 1]
+    cv::Size2d reference;   // < Resolution the camera matrix is calibrated on
+    std::vector<cv::Point2d> roiCorners;   // < Normalized region of interest
+    double topRow;   // < Normalized upper row of lane polygon
+    double bottomRow;   // < Normalized lower row of lane polygon
+    double horizon;   // < Normalized row the polygon is extended to
+    double extent;   // < Hough lines half length as a fraction of the width
+    double tolerance;   // < Polygon jump tolerance as a fraction of the width
+};
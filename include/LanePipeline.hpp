@@ -0,0 +1,154 @@
+/************************************************************************************************
+* @file      : Header file for LanePipeline class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LanePipeline class is the entry point of the lanedetect library. It takes
+*              frames in memory owned by the caller (a FrameView) and returns the lanes of
+*              every frame as a LaneResult. On top of the detection chain of LaneStream it
+*              runs the optional temporal coherence gate and the rate controller, so that a
+*              client only has to hand in frames and use the results.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <iostream>
+#include <memory>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include "FrameView.hpp"
+#include "LaneConfig.hpp"
+#include "LaneResult.hpp"
+#include "LaneStream.hpp"
+#include "ChangeDetector.hpp"
+#include "RateController.hpp"
+
+class LanePipeline {
+ public:
+    /***
+    *@brief  : Settings of a pipeline besides the camera configuration
+    *****/
+    struct Options {
+        LaneConfig config;   // < Calibration, region and thresholds
+        bool gate = false;   // < Reuse the lanes of unchanged frames
+        double gateThreshold = 2.0;   // < Mean gray level change to detect
+        int gateMaxReuse = 15;   // < Consecutive frames that may be reused
+        bool realtime = false;   // < Degrade the quality to keep up
+        double targetFps = 30;   // < Frame rate the rate controller keeps up
+        std::ostream* rateLog = &std::cout;   // < Quality level transitions
+    };
+
+    /***
+    *@brief  : Everything a pipeline carries from one frame to the next,
+    *          besides the quality level of the rate controller
+    *****/
+    struct State {
+        LaneStream::State lanes;   // < Lane history of the chain
+        bool gated = false;   // < Whether the gate has seen a frame
+        cv::Size frameSize;   // < Frame size the gate was made for
+        ChangeDetector::State gate;   // < Reference thumbnail and statistics
+    };
+
+    /***
+    *@brief  : Default constructor for LanePipeline class
+    *@params : options are the camera configuration and the pipeline settings
+    *****/
+    explicit LanePipeline(const Options& options);
+    ~LanePipeline() {}   // <Default destructor for LanePipeline class
+
+    /***
+    *@brief  : The process() function finds the lanes of the next frame. The
+    *          pixels are read in place and may be released once it returns.
+    *@params : frame describes the caller-owned pixels of the frame
+    *@return : The lanes in frame co-ordinates, with an empty polygon when the
+    *          view does not describe a valid frame
+    *****/
+    LaneResult process(const FrameView& frame);
+
+    /***
+    *@brief  : The wrap() function puts a cv::Mat header on a FrameView without
+    *          copying the pixels. The header of an NV12 frame holds both of
+    *          its planes, one after the other.
+    *@return : The header, empty when the view is not valid
+    *****/
+    static cv::Mat wrap(const FrameView& frame);
+
+    /***
+    *@brief  : The view() function describes an 8 bit cv::Mat with one, three
+    *          (BGR) or four (BGRA) channels as a FrameView
+    *@params : format is the PixelFormat of the image, such as the format() of
+    *          its FrameSource, -1 to tell it from the channels
+    *****/
+    static FrameView view(const cv::Mat& image, int format = -1);
+
+    /***
+    *@brief  : The nv12() function converts a BGR image of even width and
+    *          height to NV12, the luminance rows followed by the interleaved
+    *          U, V rows
+    *****/
+    static cv::Mat nv12(const cv::Mat& bgr);
+
+    /***
+    *@brief  : The bgr() function returns a BGR image of a frame for the
+    *          annotation and the preview, frames in BGR are not copied
+    *****/
+    static cv::Mat bgr(const cv::Mat& image, int format);
+
+    /***
+    *@brief  : The restart() function prepares the pipeline for a new clip: the
+    *          lane history and the gate are cleared, the undistortion maps and
+    *          the quality level of the rate controller are kept
+    *****/
+    void restart();
+
+    /***
+    *@brief  : The state() function saves the lane history and the gate,
+    *          such as for a checkpoint
+    *****/
+    State state() const;
+
+    /***
+    *@brief  : The restore() function continues a saved state, after which
+    *          the next frames give the lanes they gave in the saved pipeline.
+    *          With realtime the rate controller starts at full quality, so
+    *          the lanes may differ.
+    *****/
+    void restore(const State& saved);
+
+    /***
+    *@brief  : The settingsHash() function hashes the camera configuration
+    *          and the gate settings, the settings which change the lanes
+    *****/
+    uint64_t settingsHash() const;
+
+    bool detected() const { return lastDetected; }   // <Last frame ran the chain
+    const LaneStream& stream() const { return lanes; }   // <Chain and history
+    const ChangeDetector* gate() const { return changeGate.get(); }
+    const RateController& rate() const { return rateControl; }
+
+ private:
+    Options settings;   // < Pipeline settings
+    LaneStream lanes;   // < Detection chain and lane history
+    std::unique_ptr<ChangeDetector> changeGate;   // < Made on the first frame
+    cv::Size gateSize;   // < Frame size changeGate was made for
+    RateController rateControl;   // < Quality levels for real time input
+    bool lastDetected = false;   // < Whether the last frame ran the chain
+};
@@ -0,0 +1,93 @@
+/************************************************************************************************
+* @file      : Header file for the binary lane results format
+* @author    : Arun Kumar Devarajulu
+* @brief     : The binary lane results format is a fixed record layout which can be
+*              memory-mapped and indexed directly by frame. A file is made of:
+*                1.) One LaneFileHeader of 256 bytes with the frame resolution, a hash
+*                    of the camera calibration and the color thresholds; followed by
+*                2.) One LaneRecord of 96 bytes per frame, in frame order.
+*              All fields are little-endian and fixed width, so the layout is the same
+*              on every platform we run on. This header depends on the C++ standard
+*              library only, so analytics tools can read the files without OpenCV.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// Magic bytes at the start of every lane results file
+static const char kLaneFileMagic[8] = {'L', 'A', 'N', 'E', 'R', 'E', 'C', '1'};
+// Version of the record layout
+static const uint32_t kLaneFileVersion = 1;
+
+struct LaneFileHeader {
+    char magic[8];   // < Always kLaneFileMagic
+    uint32_t version;   // < Always kLaneFileVersion
+    uint32_t headerSize;   // < Size of this header in bytes
+    uint32_t recordSize;   // < Size of one LaneRecord in bytes
+    uint32_t width;   // < Width of the input frames
+    uint32_t height;   // < Height of the input frames
+    uint32_t reserved0;   // < Padding, always zero
+    uint64_t calibrationHash;   // < FNV-1a hash of the camera calibration
+    double whiteMin[3];   // < Minimum L*a*b threshold for white lanes
+    double whiteMax[3];   // < Maximum L*a*b threshold for white lanes
+    double yellowMin[3];   // < Minimum L*a*b threshold for yellow lanes
+    double yellowMax[3];   // < Maximum L*a*b threshold for yellow lanes
+    double processScale;   // < Processing scale of the detection
+    uint8_t reserved[112];   // < Room for future fields, always zero
+};
+
+struct LaneRecord {
+    uint64_t frameIndex;   // < Index of the frame in the input
+    float leftLine[4];   // < Left lane end points x1, y1, x2, y2
+    float rightLine[4];   // < Right lane end points x1, y1, x2, y2
+    int32_t polygon[8];   // < Four polygon vertices as x, y pairs
+    float slopeLeft;   // < Slope of the polygon left edge
+    float slopeRight;   // < Slope of the polygon right edge
+    uint32_t turn;   // < Turn prediction as a TurnType
+    uint32_t status;   // < Combination of StatusBits
+    uint32_t reserved[2];   // < Room for future fields, always zero
+};
+
+static_assert(sizeof(LaneFileHeader) == 256, "LaneFileHeader must be 256 bytes");
+static_assert(sizeof(LaneRecord) == 96, "LaneRecord must be 96 bytes");
+
+/***
+*@brief  : The laneHash() function computes a 64 bit FNV-1a hash of a byte buffer.
+*          It is used for the calibration hash in the file header.
+*@params : data is the buffer to hash
+*@params : size is the length of the buffer in bytes
+*@params : seed is the hash of any previous buffers, for hashing in pieces
+*@return : The 64 bit hash value
+*****/
+inline uint64_t laneHash(const void *data, size_t size, \
+                         uint64_t seed = 14695981039346656037ULL) {
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
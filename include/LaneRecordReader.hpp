@@ -0,0 +1,91 @@
+/************************************************************************************************
+* @file      : Header file for LaneRecordReader class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneRecordReader class memory-maps a binary lane results file and
+*              gives random access to its records by position or by frame index. The
+*              file is never copied into memory; the operating system pages in only
+*              the records which are actually read.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "LaneRecord.hpp"
+
+class LaneRecordReader {
+ public:
+    LaneRecordReader() {}   // <Default constructor
+    ~LaneRecordReader() { close(); }   // <Unmaps the file
+
+    /***
+    *@brief  : The open() function maps a results file and validates its header
+    *@params : path is the location of the results file
+    *@return : true if the file was mapped and has a valid header
+    *****/
+    bool open(const std::string& path);
+
+    /***
+    *@brief  : The close() function unmaps the file
+    *****/
+    void close();
+
+    /***
+    *@brief  : The size() function returns the number of complete records
+    *****/
+    size_t size() const { return recordCount; }
+
+    /***
+    *@brief  : The header() function returns the mapped file header
+    *****/
+    const LaneFileHeader& header() const { return *fileHeader; }
+
+    /***
+    *@brief  : The at() function returns the record at a position in the file
+    *@params : position is the zero based record position
+    *****/
+    const LaneRecord& at(size_t position) const { return records[position]; }
+
+    /***
+    *@brief  : The find() function returns the record of a frame
+    *@params : frameIndex is the index of the frame in the input
+    *@return : A pointer to the record, or nullptr if the frame is not stored
+    *****/
+    const LaneRecord *find(uint64_t frameIndex) const;
+
+    /***
+    *@brief  : The error() function describes why open() failed
+    *****/
+    const std::string& error() const { return lastError; }
+
+ private:
+    LaneRecordReader(const LaneRecordReader&) = delete;
+    LaneRecordReader& operator=(const LaneRecordReader&) = delete;
+
+    void *mapping = nullptr;   // < Start of the mapped file
+    size_t mappedBytes = 0;   // < Length of the mapping
+    const LaneFileHeader *fileHeader = nullptr;   // < Mapped header
+    const LaneRecord *records = nullptr;   // < Mapped records
+    size_t recordCount = 0;   // < Number of complete records
+    std::string lastError;   // < Reason of the last failure
+};
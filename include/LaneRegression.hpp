@@ -0,0 +1,132 @@
+/************************************************************************************************
+* @file      : Lane detection regression harness
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneRegression class runs the lane pipeline over a suite of recorded or synthetic
+*              clips, compares the lanes of every frame with stored golden results within tolerances
+*              and reports the throughput and the time spent in each stage of the detection chain.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+#include "LaneConfig.hpp"
+#include "LaneRecord.hpp"
+#include "LaneStream.hpp"
+#include "SceneGenerator.hpp"
+
+class LaneRegression {
+ public:
+    /***
+    *@brief  : One clip of a suite and the golden results it is checked against
+    *****/
+    struct Clip {
+        LaneConfig config;   // < Name, input, calibration and thresholds
+        bool synthetic = false;   // < Rendered by SceneGenerator, no input
+        SceneGenerator::Settings scene;   // < Road of a synthetic clip
+        long frames = 0;   // < Frames to process, zero for the whole input
+        double fps = 30;   // < Frame rate of a synthetic clip
+        std::string golden;   // < Binary results file holding the golden lanes
+        double lineTolerance = 2.0;   // < Pixels a lane line end may move
+        double polygonTolerance = 3.0;   // < Pixels a polygon vertex may move
+        long maxMismatched = 0;   // < Frames allowed outside the tolerances
+    };
+
+    /***
+    *@brief  : Outcome of one clip
+    *****/
+    enum Verdict {
+        PASSED,   // < Every frame within the tolerances
+        FAILED,   // < Too many frames outside the tolerances
+        RECORDED,   // < The golden results were written
+        SKIPPED,   // < The input of the clip is not available
+        BROKEN   // < The clip or its golden results could not be read
+    };
+
+    /***
+    *@brief  : Accuracy deltas and timings of one clip
+    *****/
+    struct Report {
+        std::string name;   // < Name of the clip
+        Verdict verdict = BROKEN;   // < Outcome of the clip
+        std::string message;   // < Reason of a failure
+        long frames = 0;   // < Frames processed
+        cv::Size frameSize;   // < Resolution of the clip
+        double seconds = 0;   // < Time spent in LanePipeline::process
+        LaneStream::StageTimes stages;   // < Time spent in each stage
+        double maxLineDelta = 0;   // < Largest move of a lane line end
+        double maxPolygonDelta = 0;   // < Largest move of a polygon vertex
+        double meanPolygonDelta = 0;   // < Mean of the largest vertex moves
+        long mismatched = 0;   // < Frames outside the tolerances
+        long statusChanges = 0;   // < Frames with other status bits or turn
+    };
+
+    /***
+    *@brief  : The loadSuite() function reads a YAML or XML file with a "clips"
+    *          sequence. Every clip takes the keys of LaneConfig::read plus
+    *          golden, frames, line_tolerance, polygon_tolerance,
+    *          max_mismatched and, instead of input, a scene map with width,
+    *          height, fps, curvature, left, right, shadows, noise, distort,
+    *          speed and seed. Relative paths start at the suite file.
+    *@params : path is the suite file
+    *@params : error receives a description of the first problem
+    *@return : The clips in file order, empty on error
+    *****/
+    static std::vector<Clip> loadSuite(const std::string& path, \
+                                       std::string& error);
+
+    /***
+    *@brief  : The run() function processes a clip with a fresh pipeline and
+    *          compares every frame with the golden results
+    *@params : clip is the clip to run
+    *@params : record writes the golden results instead of comparing. Without
+    *          it a clip whose golden file does not exist fails.
+    *@return : The deltas and timings of the clip
+    *****/
+    static Report run(const Clip& clip, bool record);
+
+    /***
+    *@brief  : The compare() function measures how far the lanes of a frame
+    *          moved from the golden record, as the largest distance of the
+    *          lane line ends and of the polygon vertices
+    *****/
+    static void compare(const LaneRecord& golden, const LaneRecord& actual, \
+                        double& lineDelta, double& polygonDelta);
+
+    /***
+    *@brief  : The writeTable() function prints the reports as a table
+    *****/
+    static void writeTable(std::ostream& out, \
+                           const std::vector<Report>& reports);
+
+    /***
+    *@brief  : The writeCsv() function writes the reports as CSV, one row per
+    *          clip with the timings in milliseconds per frame
+    *****/
+    static void writeCsv(std::ostream& out, const std::vector<Report>& reports);
+
+    /***
+    *@brief  : The verdictName() function names a Verdict for the reports
+    *****/
+    static const char* verdictName(Verdict verdict);
+};
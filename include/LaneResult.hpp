@@ -0,0 +1,65 @@
+/************************************************************************************************
+* @file      : Header file for the per-frame lane result
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneResult structure holds everything the pipeline knows about the
+*              lanes of one frame: the averaged left and right HoughLines from
+*              LanesMarker, the polygon vertices from RegionMaker, the slopes used for
+*              the turn prediction and the status bits telling how the result was made.
+*              All co-ordinates are in full resolution frame pixels.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include "opencv2/core.hpp"
+#include <opencv2/core/core.hpp>
+
+// Version of the detection output, raised with every change which alters the
+// lanes, so that results cached by an older version are not reused
+static const uint32_t kLaneEngineVersion = 1;
+
+// Turn prediction made from the lane slopes
+enum TurnType {
+    TURN_NONE = 0,   // < Both lanes deviate equally
+    TURN_LEFT = 1,   // < Left turn ahead
+    TURN_RIGHT = 2   // < Right turn ahead
+};
+
+// Status bits telling how the lane polygon of a frame was obtained
+enum StatusBits {
+    STATUS_REUSED = 1,   // < Reused by the temporal coherence gate
+    STATUS_EXTRAPOLATED = 2,   // < Extrapolated by the rate controller
+    STATUS_HISTORIC = 4   // < Detection rejected, previous polygon kept
+};
+
+struct LaneResult {
+    long frameIndex = 0;   // < Index of the frame in the input
+    std::pair<cv::Point2d, cv::Point2d> leftLine;   // < Averaged left lane
+    std::pair<cv::Point2d, cv::Point2d> rightLine;   // < Averaged right lane
+    std::vector<cv::Point> polygon;   // < Lane polygon vertices
+    double slopeLeft = 0;   // < Slope of the polygon left edge
+    double slopeRight = 0;   // < Slope of the polygon right edge
+    int turn = TURN_NONE;   // < Turn prediction as a TurnType
+    unsigned status = 0;   // < Combination of StatusBits
+};
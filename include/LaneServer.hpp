@@ -0,0 +1,150 @@
+/************************************************************************************************
+* @file      : Header file for LaneServer class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneServer class is the daemon mode of the detector. It listens on a UNIX domain
+*              socket and runs the jobs of its clients on one work-stealing thread pool with a set of
+*              warm pipelines, whose undistortion maps and buffers survive from job to job. A job is
+*              a video file, a directory of numbered frames or a finished shared memory frame ring;
+*              its lane results are streamed back line by line while it runs. The jobs of one client
+*              run one after the other, so its results arrive in request order.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <atomic>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "LanePipeline.hpp"
+#include "ThreadPool.hpp"
+
+class LaneServer {
+ public:
+    struct Options {
+        std::string socketPath;   // < Path of the listening socket
+        int threads = 1;   // < Workers shared by all the jobs
+        std::vector<int> cores;   // < Cores of the workers, empty for any
+        LanePipeline::Options pipeline;   // < Settings of every pipeline
+        double ringTimeout = 5.0;   // < Wait for a frame of a ring job
+        std::ostream* log = &std::cout;   // < Connections and job throughput
+    };
+
+    /***
+    *@brief  : Default constructor for LaneServer class
+    *@params : options are the socket, the pool size and the pipeline settings
+    *****/
+    explicit LaneServer(const Options& options);
+
+    /***
+    *@brief  : The destructor stops the server
+    *****/
+    ~LaneServer();
+
+    /***
+    *@brief  : The start() function warms up one pipeline per worker, binds the
+    *          socket and starts accepting clients in the background
+    *@return : true if the server is listening
+    *****/
+    bool start();
+
+    /***
+    *@brief  : The stop() function closes the socket, cancels the running jobs,
+    *          disconnects the clients and removes the socket file
+    *****/
+    void stop();
+
+    size_t jobsDone() const { return finishedJobs; }   // <Jobs run to the end
+    size_t clientsServed() const { return acceptedClients; }   // <Connections
+    const std::string& error() const { return lastError; }   // <Last failure
+
+ private:
+    LaneServer(const LaneServer&) = delete;
+    LaneServer& operator=(const LaneServer&) = delete;
+
+    struct Job;
+    struct Client;
+
+    /***
+    *@brief  : The acceptLoop() function accepts clients until stop()
+    *****/
+    void acceptLoop();
+
+    /***
+    *@brief  : The readLoop() function reads the requests of a client
+    *****/
+    void readLoop(std::shared_ptr<Client> client);
+
+    /***
+    *@brief  : The request() function queues the job of one request line
+    *****/
+    void request(const std::shared_ptr<Client>& client, const std::string& line);
+
+    /***
+    *@brief  : The startNext() function submits the next job of an idle client
+    *****/
+    void startNext(const std::shared_ptr<Client>& client);
+
+    /***
+    *@brief  : The step() function runs a batch of frames of the current job of
+    *          a client, sends their results and submits itself again
+    *****/
+    void step(std::shared_ptr<Client> client);
+
+    /***
+    *@brief  : The open() function opens the input of a job
+    *@return : An empty string on success, otherwise the reason of the failure
+    *****/
+    std::string open(Job& job);
+
+    /***
+    *@brief  : The finish() function reports a job, returns its pipeline and
+    *          starts the next job of the client
+    *****/
+    void finish(const std::shared_ptr<Client>& client, const std::string& reply);
+
+    std::unique_ptr<LanePipeline> checkout();   // <Takes or makes a pipeline
+    void checkin(std::unique_ptr<LanePipeline> pipeline);   // <Keeps it warm
+
+    /***
+    *@brief  : The reap() function joins the readers of departed clients
+    *****/
+    void reap(bool all);
+
+    Options settings;   // < Server settings
+    int listenFd = -1;   // < Listening socket
+    std::unique_ptr<ThreadPool> pool;   // < Workers running the jobs
+    std::thread acceptor;   // < Thread of acceptLoop()
+    std::atomic<bool> stopping;   // < Set by stop()
+    std::mutex clientsMutex;   // < Guards clients
+    std::list<std::shared_ptr<Client>> clients;   // < Connected clients
+    std::mutex idleMutex;   // < Guards idle
+    std::vector<std::unique_ptr<LanePipeline>> idle;   // < Warm pipelines
+    std::mutex logMutex;   // < Guards the log
+    std::atomic<size_t> finishedJobs;   // < Jobs run to the end
+    std::atomic<size_t> acceptedClients;   // < Clients accepted
+    std::string lastError;   // < Description of the last failure
+};
@@ -0,0 +1,239 @@
+/************************************************************************************************
+* @file      : Header file for LaneStream class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneStream class runs the lane detection chain (Cleaner, Thresholder,
+*              LanesMarker and RegionMaker) on the frames of one video stream. The chain
+*              objects and the lane history belong to the stream and are reused from frame
+*              to frame, so several streams can be processed side by side on a thread pool
+*              as long as the frames of one stream are handed in one after the other.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <vector>
+#include <utility>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include "Cleaner.hpp"
+#include "Thresholder.hpp"
+#include "LanesMarker.hpp"
+#include "RegionMaker.hpp"
+#include "LaneGeometry.hpp"
+#include "LaneFitter.hpp"
+#include "LaneConfig.hpp"
+#include "LaneResult.hpp"
+#include "FrameView.hpp"
+
+class LaneStream {
+ public:
+    /***
+    *@brief  : Settings the rate controller may lower to keep up with the source
+    *****/
+    struct Quality {
+        double scaleFactor = 1.0;   // < Factor applied to the processing scale
+        double houghFactor = 1;   // < Factor applied to the Hough resolutions
+        bool smoothing = true;   // < Whether gaussian smoothing is applied
+    };
+
+    /***
+    *@brief  : Seconds spent in each stage of the detection chain, summed over
+    *          the frames which ran it
+    *****/
+    struct StageTimes {
+        double prepare = 0;   // < Downscaling, undistortion and smoothing,
+                              //   and the masks when they run in bands
+        double threshold = 0;   // < L*a*b masks and the region of interest
+        double edges = 0;   // < Canny edges of the lane mask
+        double hough = 0;   // < HoughLines and lane line averaging, or the
+                            //   lane fit of the window engine
+        double polygon = 0;   // < Lane polygon search and extrapolation
+        long frames = 0;   // < Frames which ran the chain
+    };
+
+    /***
+    *@brief  : Everything a stream carries from one frame to the next. The
+    *          lanes are in the co-ordinates of the processing size.
+    *****/
+    struct State {
+        long counter = 1;   // < Number of the next frame, starting at one
+        cv::Size procSize;   // < Processing size of the lanes
+        std::vector<cv::Point> historicLane;   // < Polygon of the last frame
+        std::vector<cv::Point> olderLane;   // < Polygon of the frame before
+        std::pair<cv::Point2d, cv::Point2d> leftLine;   // < Left lane line
+        std::pair<cv::Point2d, cv::Point2d> rightLine;   // < Right lane line
+        cv::Vec3d leftFit, rightFit;   // < Lane curves of the window engine
+        bool tracking = false;   // < Whether the curves are tracked
+        StageTimes times;   // < Time spent in each stage of the chain
+    };
+
+    /***
+    *@brief  : Default constructor for LaneStream class
+    *@params : config holds the calibration, region and thresholds of the camera
+    *****/
+    explicit LaneStream(const LaneConfig& config);
+    ~LaneStream() {}   // <Default destructor for LaneStream class
+
+    /***
+    *@brief  : The detect() function runs the detection chain on a frame
+    *@params : frame is the full resolution input frame, it is not modified
+    *@params : quality are the settings of the rate controller
+    *@params : format is the PixelFormat of the frame, only the downscaled
+    *          image is converted to BGR. The Hough engine masks the planes
+    *          of NV12 frames without converting them, and frame then holds
+    *          both planes.
+    *@return : The lanes in full resolution co-ordinates
+    *****/
+    LaneResult detect(const cv::Mat& frame, const Quality& quality, \
+                      int format = PIXEL_BGR);
+
+    /***
+    *@brief  : The reuse() function repeats the last lanes for a frame which has
+    *          not changed
+    *****/
+    LaneResult reuse(const cv::Mat& frame);
+
+    /***
+    *@brief  : The extrapolate() function continues the motion of the last two
+    *          lanes for a frame which is not processed
+    *****/
+    LaneResult extrapolate(const cv::Mat& frame);
+
+    /***
+    *@brief  : The restart() function forgets the lanes of the previous frames so
+    *          that the next frame starts a new clip. The undistortion maps and
+    *          buffers of the current processing size are kept.
+    *****/
+    void restart();
+
+    /***
+    *@brief  : The state() function saves the lane history, such as for a
+    *          checkpoint
+    *****/
+    State state() const;
+
+    /***
+    *@brief  : The restore() function continues a saved lane history, so that
+    *          the next frame gives the result it gave in the saved stream
+    *****/
+    void restore(const State& saved);
+
+    /***
+    *@brief  : The annotate() function fills the lane polygon and writes the turn
+    *          prediction onto a frame
+    *****/
+    static void annotate(cv::Mat& frame, const LaneResult& result);
+
+    const LaneGeometry& geometry() const { return fullGeometry; }
+    long frameCount() const { return counter - 1; }   // <Frames handled
+    const StageTimes& stageTimes() const { return times; }   // <Chain timings
+
+    /***
+    *@brief  : Images of the last frame for the debug windows. With the window
+    *          engine the color mask and the edges are both the top-down lane
+    *          mask, and the lane lines are the fitted curves.
+    *****/
+    cv::Mat lanesMask() const { return maskView; }   // <Last color mask
+    cv::Mat edges() const { return edgeView; }   // <Last Canny edges
+    cv::Mat houghLines() const { return houghView; }   // <Last lane lines
+
+ private:
+    /***
+    *@brief  : The finish() function extends the polygon to the horizon and maps
+    *          the lanes back to the frame resolution
+    *****/
+    LaneResult finish(std::vector<cv::Point> polygon, unsigned status, \
+                      cv::Size frameSize);
+
+    /***
+    *@brief  : The houghLanes() function finds the lane polygon with Canny,
+    *          HoughLines and the RegionMaker search
+    *****/
+    std::vector<cv::Point> houghLanes(const cv::Mat& procFrame, \
+                                      const cv::Mat& procChroma, \
+                                      const Quality& quality, \
+                                      bool smoothing, int64& tick);
+
+    /***
+    *@brief  : The windowLanes() function finds the lane polygon with the
+    *          LaneFitter on the top-down view of the road area. The polygon
+    *          corners are the ends of the fitted curves on the frame.
+    *****/
+    std::vector<cv::Point> windowLanes(const cv::Mat& procFrame, \
+                                       bool smoothing, int64& tick);
+
+    /***
+    *@brief  : The prepareBirdsEye() function sets the top-down view of the
+    *          Cleaner for the processing size
+    *****/
+    void prepareBirdsEye();
+
+    /***
+    *@brief  : The maskFrame() function runs the per-pixel stages one after the
+    *          other on the whole frame, keeping their images in the Cleaner
+    *          and the Thresholder
+    *****/
+    void maskFrame(const cv::Mat& procFrame, bool smoothing, \
+                   const cv::Mat& roiMask, cv::Mat& lanesMask, \
+                   cv::Mat& interestLanes, int64& tick);
+
+    /***
+    *@brief  : The maskPlanes() function masks the luminance and chroma
+    *          planes of an NV12 frame with the Y, U, V thresholds which the
+    *          Thresholder derives from its L*a*b thresholds
+    *****/
+    void maskPlanes(const cv::Mat& luma, const cv::Mat& chroma, \
+                    bool smoothing, const cv::Mat& roiMask, \
+                    cv::Mat& lanesMask, cv::Mat& interestLanes, int64& tick);
+
+    /***
+    *@brief  : The maskBands() function runs the per-pixel stages in bands of
+    *          rows which stay in the cache, the bands in parallel. The masks
+    *          are identical to those of maskFrame().
+    *****/
+    void maskBands(const cv::Mat& procFrame, bool smoothing, \
+                   const cv::Mat& roiMask, cv::Mat& lanesMask, \
+                   cv::Mat& interestLanes);
+
+    LaneConfig settings;   // < Calibration, region and thresholds
+    LaneGeometry fullGeometry;   // < Geometry at the configured scale
+    LaneGeometry reducedGeometry;   // < Geometry at half the configured scale
+    Cleaner cleaner;   // < Undistortion for the current processing size
+    Cleaner chromaCleaner;   // < Undistortion of the NV12 chroma plane
+    cv::Size chromaSize;   // < Size of the chroma plane chromaCleaner is for
+    Thresholder thresholder;   // < White and yellow lane masks
+    LanesMarker marker;   // < HoughLines averaging
+    RegionMaker regions;   // < Lane polygon search
+    LaneFitter fitter;   // < Lane curves of the window engine
+    cv::Size procSize;   // < Size of the image the detection runs on
+    cv::Size chainSize;   // < Processing size the chain is prepared for
+    std::vector<cv::Vec2f> lines;   // < HoughLines of the current frame
+    std::vector<cv::Point> historicLane;   // < Polygon of the last frame
+    std::vector<cv::Point> olderLane;   // < Polygon of the frame before
+    std::pair<cv::Point2d, cv::Point2d> leftLine;   // < Last left lane line
+    std::pair<cv::Point2d, cv::Point2d> rightLine;   // < Last right lane line
+    long counter = 1;   // < Number of the next frame, starting at one
+    long historicFrame = 0;   // < Frame of historicLane, 0 when unknown
+    long olderFrame = 0;   // < Frame of olderLane, 0 when unknown
+    StageTimes times;   // < Time spent in each stage of the chain
+    cv::Mat maskView, edgeView, houghView;   // < Images for the debug windows
+};
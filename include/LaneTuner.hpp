@@ -0,0 +1,143 @@
+/************************************************************************************************
+* @file      : Detection parameter autotuner
+* @author    : Arun Kumar Devarajulu
+* @brief     : The LaneTuner class searches the settings of the detection chain on the clips of a
+*              regression suite for the ones which keep up with a target frame rate on this machine
+*              with the least distance from the true lanes of the synthetic clips, or from the golden
+*              lanes of clips without a truth, and writes them as a configuration file.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+#include "LaneConfig.hpp"
+#include "LaneRegression.hpp"
+#include "LaneResult.hpp"
+#include "SceneGenerator.hpp"
+
+class LaneTuner {
+ public:
+    // Number of settings the tuner searches
+    static const int kKnobs = 7;
+
+    /***
+    *@brief  : One point of the search space and how it performed
+    *****/
+    struct Candidate {
+        int levels[kKnobs] = {0};   // < Chosen value of every knob
+        double fps = 0;   // < Frames per second of LanePipeline::process
+        double error = 0;   // < Mean lane distance in pixels of a 1280 frame
+        long mismatched = 0;   // < Frames outside the tolerances or missed
+        long frames = 0;   // < Frames measured
+        long truthFrames = 0;   // < Frames scored against their SceneTruth
+
+        /***
+        *@brief  : The apply() function writes the settings of the candidate
+        *          into a configuration
+        *****/
+        void apply(LaneConfig& config) const;
+    };
+
+    struct Options {
+        double targetFps = 30;   // < Frame rate the settings must keep up
+        int trials = 48;   // < Random candidates before the refinement
+        long framesPerClip = 60;   // < Frames of every clip to measure
+        unsigned seed = 1;   // < Seed of the random candidates
+        std::ostream* log = &std::cout;   // < Progress of the search
+    };
+
+    /***
+    *@brief  : Default constructor for LaneTuner class
+    *@params : clips are the clips of a regression suite. Synthetic clips
+    *          are scored against the SceneTruth of their frames, recorded
+    *          ones against their golden results and left out without them
+    *@params : options are the target and the size of the search
+    *****/
+    LaneTuner(const std::vector<LaneRegression::Clip>& clips, \
+              const Options& options);
+
+    /***
+    *@brief  : The evaluate() function runs every clip with the settings of a
+    *          candidate and fills in its frame rate and error
+    *****/
+    void evaluate(Candidate& candidate) const;
+
+    /***
+    *@brief  : The truthError() function measures how far the polygon edges
+    *          of a frame lie from the true lane centres, as the mean column
+    *          distance at rows sampled along both edges
+    *@params : result is the detection of the frame
+    *@params : truth holds the lanes the frame was rendered with
+    *@params : cap is the largest distance of a sample, and the distance of
+    *          a frame whose polygon does not reach the true lanes
+    *****/
+    static double truthError(const LaneResult& result, \
+                             const SceneTruth& truth, double cap);
+
+    /***
+    *@brief  : The search() function measures the compiled-in defaults and
+    *          random candidates, then the neighbours of every candidate on
+    *          the Pareto front
+    *@return : Every candidate measured
+    *****/
+    std::vector<Candidate> search() const;
+
+    /***
+    *@brief  : The paretoFront() function keeps the candidates no other one
+    *          beats in both frame rate and error
+    *@return : The front, fastest first
+    *****/
+    static std::vector<Candidate> paretoFront( \
+            const std::vector<Candidate>& candidates);
+
+    /***
+    *@brief  : The choose() function picks the most accurate candidate of a
+    *          front which keeps up with the target, or the fastest one when
+    *          none does
+    *****/
+    static Candidate choose(const std::vector<Candidate>& front, \
+                            double targetFps);
+
+    /***
+    *@brief  : The write() function stores the chosen settings at the top level
+    *          of a file which --config reads, followed by the whole front,
+    *          and tells how many frames were scored against a truth
+    *@return : false if the file cannot be written
+    *****/
+    static bool write(const std::string& path, const Candidate& chosen, \
+                      const std::vector<Candidate>& front, double targetFps);
+
+    size_t clipCount() const { return suite.size(); }   // <Clips measured
+
+ private:
+    /***
+    *@brief  : The scoreTruth() function runs a synthetic clip and adds its
+    *          time, frames and distances from the SceneTruth to a candidate
+    *****/
+    void scoreTruth(const LaneRegression::Clip& clip, Candidate& candidate, \
+                    double& seconds, double& error) const;
+
+    std::vector<LaneRegression::Clip> suite;   // < Synthetic or golden clips
+    Options settings;   // < Target and size of the search
+};
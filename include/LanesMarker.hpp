@@ -53,12 +53,18 @@ class LanesMarker {
     typedef std::vector<cv::Vec2f> hType;
 
  public:
-    LanesMarker() {}  // Default constructor
+    /***
+    *@brief  : Default constructor for LanesMarker class
+    *@params : extent is the distance in pixels by which every HoughLine is
+    *          extrapolated on both sides of its closest point to the origin
+    *****/
+    explicit LanesMarker(double extent = 1500) : lineExtent(extent) {}
     ~LanesMarker() {}  // Default destructor
 
     /***
     *@brief  : The lanesSegregator() is used for segregating the left and right lanes based on
-    *          positive and negative slopes of HoughLines
+    *          positive and negative slopes of HoughLines. Every call starts a new frame, so
+    *          one LanesMarker can be kept per video stream
     *@params : The parameter hLines is the output obtained from cv::HoughLines function. It is
     *          nothing but an array of pairs containing rho and theta
     *****/
@@ -75,6 +81,8 @@ class LanesMarker {
     pointsPair rightLanesAverage();
 
  private:
+    // Distance by which the HoughLines are extrapolated
+    double lineExtent;
     // Variable for temporary storage of HoughLines rho
     float rho = 0;
     // Variable for temporary storage of HoughLines theta
@@ -0,0 +1,114 @@
+/************************************************************************************************
+* @file      : Header file for OutputWriter class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The OutputWriter class moves all output I/O off the detection loop. The
+*              detection thread pushes the annotated frame and the lane result of every
+*              frame into a small bounded queue, and a writer thread hands them to the
+*              registered ResultSinks in order. When no sink needs images the frames
+*              are not even queued. A full queue blocks the producer, so memory use
+*              stays bounded when the sinks are slower than the detection.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <condition_variable>
+#include "opencv2/core.hpp"
+#include <opencv2/core/core.hpp>
+#include "LaneResult.hpp"
+#include "ResultSink.hpp"
+
+class OutputWriter {
+ public:
+    /***
+    *@brief  : Default constructor for OutputWriter class
+    *@params : capacity is the number of frames the queue can hold
+    *****/
+    explicit OutputWriter(size_t capacity = 8) : maxQueue(capacity) {}
+    ~OutputWriter() { close(); }   // <Drains the queue and stops the thread
+
+    /***
+    *@brief  : The addSink() function registers a sink. Sinks must be added
+    *          before the first frame is pushed.
+    *@params : sink is the sink that takes ownership of the output
+    *****/
+    void addSink(std::unique_ptr<ResultSink> sink);
+
+    /***
+    *@brief  : The needsFrame() function tells whether any sink uses the image,
+    *          so that the caller can skip drawing when nobody needs it
+    *****/
+    bool needsFrame() const;
+
+    /***
+    *@brief  : The start() function starts the writer thread, which push()
+    *          otherwise does on the first frame, so that the thread inherits
+    *          the cores of the caller
+    *****/
+    void start();
+
+    /***
+    *@brief  : The push() function queues the output of one frame. After
+    *          close() the output is dropped with a warning.
+    *@params : frame is the annotated frame. The writer keeps a reference to
+    *          the image data, so the caller must not draw on it afterwards
+    *@params : result is the lane result of the frame
+    *****/
+    void push(const cv::Mat& frame, const LaneResult& result);
+
+    /***
+    *@brief  : The close() function writes all queued frames and closes the sinks
+    *****/
+    void close();
+
+    /***
+    *@brief  : The positions() function waits until every pushed frame is
+    *          written, or the writer thread is gone, and returns the
+    *          position() of every sink, in the order they were added, for a
+    *          checkpoint
+    *****/
+    std::vector<long long> positions();
+
+ private:
+    /***
+    *@brief  : The run() function is the body of the writer thread
+    *****/
+    void run();
+
+    std::vector<std::unique_ptr<ResultSink>> sinks;   // < Registered sinks
+    std::deque<std::pair<cv::Mat, LaneResult>> queue;   // < Pending outputs
+    size_t maxQueue;   // < Capacity of the queue
+    bool imagesNeeded = false;   // < Whether any sink uses the images
+    bool stopping = false;   // < Set when no more frames will be pushed
+    bool writing = false;   // < Set while the sinks write a frame
+    bool running = false;   // < Set while the writer thread takes frames
+    std::mutex queueMutex;   // < Guards the queue and the stopping flag
+    std::condition_variable notEmpty;   // < Signalled on push and close
+    std::condition_variable notFull;   // < Signalled when a slot frees up
+    std::condition_variable written;   // < Signalled when a frame is written
+    std::thread worker;   // < Writer thread
+};
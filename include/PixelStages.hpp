@@ -0,0 +1,243 @@
+/************************************************************************************************
+* @file      : Composable per-pixel stages
+* @author    : Arun Kumar Devarajulu
+* @brief     : Header only templates which describe the point-wise stages of the lane masks, a color
+*              conversion, range tests, their combination and the region of interest, as functors the
+*              compiler fuses into one loop per image, specialized for the pixel type and channels.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <algorithm>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+
+/***
+*@brief  : LANE_CLONES marks the functions which run the hot pixel loops. With
+*          LANE_MULTIVERSION the compiler emits an AVX-512, an AVX2 and a
+*          baseline variant of each and the loader picks the one the CPU
+*          runs, so one binary uses the wide vectors of the machine it runs
+*          on. Without it, or without ifunc support, the functions are plain.
+*****/
+#if defined(LANE_MULTIVERSION) && defined(__x86_64__) && \
+    defined(__linux__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define LANE_CLONES __attribute__((target_clones("arch=skylake-avx512", \
+                                                 "avx2", "default")))
+#endif
+#endif
+#ifndef LANE_CLONES
+#define LANE_CLONES
+#endif
+
+/***
+*@brief  : The PixelRange rule tells whether every channel of a pixel lies
+*          within its bounds. The bounds are rounded to integers the way
+*          cv::inRange does for integer images, so both give the same mask.
+*****/
+template <typename T, int Channels>
+struct PixelRange {
+    typedef T Type;   // < Type of a channel
+    static const int channels = Channels;   // < Channels of a pixel
+
+    PixelRange(const cv::Scalar& lowest, const cv::Scalar& highest) {
+        for (int c = 0; c < Channels; c++) {
+            low[c] = cvRound(lowest[c]);
+            high[c] = cvRound(highest[c]);
+        }
+    }
+
+    bool operator()(const T* pixel) const {
+        // Without branches the compiler unrolls and vectorizes the channels
+        bool inside = true;
+        for (int c = 0; c < Channels; c++)
+            inside &= pixel[c] >= low[c] && pixel[c] <= high[c];
+        return inside;
+    }
+
+    int low[Channels];   // < Lowest value of every channel
+    int high[Channels];   // < Highest value of every channel
+};
+
+/***
+*@brief  : The PixelAnyOf rule accepts a pixel which any of its rules accepts,
+*          like a cv::bitwise_or of their masks. More rules cost one more test
+*          per pixel and no extra pass over the image.
+*****/
+template <typename... Rules>
+struct PixelAnyOf;
+
+template <typename Rule>
+struct PixelAnyOf<Rule> {
+    typedef typename Rule::Type Type;   // < Type of a channel
+    static const int channels = Rule::channels;   // < Channels of a pixel
+
+    explicit PixelAnyOf(const Rule& only) : rule(only) {}
+
+    bool operator()(const Type* pixel) const { return rule(pixel); }
+
+    Rule rule;   // < The only rule
+};
+
+template <typename Rule, typename... Rest>
+struct PixelAnyOf<Rule, Rest...> {
+    typedef typename Rule::Type Type;   // < Type of a channel
+    static const int channels = Rule::channels;   // < Channels of a pixel
+
+    PixelAnyOf(const Rule& first, const Rest&... others) : \
+        rule(first), rest(others...) {}
+
+    bool operator()(const Type* pixel) const {
+        return rule(pixel) | rest(pixel);
+    }
+
+    Rule rule;   // < The first rule
+    PixelAnyOf<Rest...> rest;   // < The other rules
+};
+
+/***
+*@brief  : The anyOf() function combines rules of the same pixel layout
+*****/
+template <typename... Rules>
+PixelAnyOf<Rules...> anyOf(const Rules&... rules) {
+    return PixelAnyOf<Rules...>(rules...);
+}
+
+/***
+*@brief  : The KeepPixels conversion hands the pixels to the rule unchanged
+*****/
+struct KeepPixels {
+    cv::Mat operator()(const cv::Mat& rows, cv::Mat& buffer) const {
+        (void)buffer;
+        return rows;
+    }
+};
+
+/***
+*@brief  : The ConvertPixels conversion runs cv::cvtColor on a few rows at a
+*          time into a buffer which stays in the cache. Every color
+*          conversion is point-wise, so the rule sees exactly the pixels the
+*          conversion of the whole image gives.
+*****/
+struct ConvertPixels {
+    explicit ConvertPixels(int colorCode) : code(colorCode) {}
+
+    cv::Mat operator()(const cv::Mat& rows, cv::Mat& buffer) const {
+        cv::cvtColor(rows, buffer, code);
+        return buffer;
+    }
+
+    int code;   // < cv::ColorConversionCodes value
+};
+
+/***
+*@brief  : The fuseMask() function converts, tests and masks an image in one
+*          pass. A chunk of rows is converted while it is in the cache and the
+*          rule and the region of interest run in a single loop over it, so no
+*          intermediate image of the whole frame is made.
+*@params : image is the input image, such as a band of rows of a frame
+*@params : convert is KeepPixels, ConvertPixels or another conversion
+*@params : rule is a PixelRange, a PixelAnyOf or another rule
+*@params : roi has the size of image, pixels outside it are zero in inside,
+*          and an empty roi covers the whole image
+*@params : mask receives 255 where the rule holds and 0 elsewhere
+*@params : inside receives mask within the roi and 0 outside of it
+*@return : false if the converted pixels do not have the layout of the rule
+*****/
+template <typename Convert, typename Rule>
+bool fuseMask(const cv::Mat& image, const Convert& convert, const Rule& rule, \
+              const cv::Mat& roi, cv::Mat& mask, cv::Mat& inside) {
+    typedef typename Rule::Type T;
+    const int channels = Rule::channels;
+    mask.create(image.size(), CV_8U);
+    inside.create(image.size(), CV_8U);
+
+    // Chunks of about 32 KB of input stay in the cache while converted
+    size_t rowBytes = std::max<size_t>(1, image.cols * image.elemSize());
+    int chunk = std::max(1, static_cast<int>(32768 / rowBytes));
+    cv::Mat buffer;
+    for (int first = 0; first < image.rows; first += chunk) {
+        int last = std::min(image.rows, first + chunk);
+        cv::Mat pixels = convert(image.rowRange(first, last), buffer);
+        if (pixels.depth() != cv::DataType<T>::depth || \
+            pixels.channels() != channels)
+            return false;
+        for (int y = first; y < last; y++) {
+            const T* in = pixels.ptr<T>(y - first);
+            uchar* out = mask.ptr<uchar>(y);
+            uchar* kept = inside.ptr<uchar>(y);
+            if (roi.empty()) {
+                for (int x = 0; x < image.cols; x++)
+                    out[x] = kept[x] = rule(in + x * channels) ? 255 : 0;
+                continue;
+            }
+            const uchar* region = roi.ptr<uchar>(y);
+            for (int x = 0; x < image.cols; x++) {
+                uchar value = rule(in + x * channels) ? 255 : 0;
+                out[x] = value;
+                kept[x] = region[x] ? value : 0;
+            }
+        }
+    }
+    return true;
+}
+
+/***
+*@brief  : The fuseMaskNv12() function tests the pixels of the two planes of an
+*          NV12 frame without converting them. Every pixel is handed to the
+*          rule as Y, U, V with the chroma of its 2x2 block, as
+*          cv::COLOR_YUV2BGR_NV12 pairs them.
+*@params : luma is the CV_8UC1 luminance plane
+*@params : chroma is the CV_8UC2 interleaved U, V plane at half the width and
+*          height, rounded up
+*@params : rule is a three channel 8 bit rule on Y, U, V
+*@params : roi, mask and inside are those of fuseMask()
+*@return : false if the planes or the rule do not have the NV12 layout
+*****/
+template <typename Rule>
+bool fuseMaskNv12(const cv::Mat& luma, const cv::Mat& chroma, \
+                  const Rule& rule, const cv::Mat& roi, cv::Mat& mask, \
+                  cv::Mat& inside) {
+    if (luma.type() != CV_8UC1 || chroma.type() != CV_8UC2 || \
+        chroma.cols != (luma.cols + 1) / 2 || \
+        chroma.rows != (luma.rows + 1) / 2 || \
+        cv::DataType<typename Rule::Type>::depth != CV_8U || \
+        Rule::channels != 3)
+        return false;
+    mask.create(luma.size(), CV_8U);
+    inside.create(luma.size(), CV_8U);
+    for (int y = 0; y < luma.rows; y++) {
+        const uchar* in = luma.ptr<uchar>(y);
+        const uchar* uv = chroma.ptr<uchar>(y / 2);
+        uchar* out = mask.ptr<uchar>(y);
+        uchar* kept = inside.ptr<uchar>(y);
+        const uchar* region = roi.empty() ? nullptr : roi.ptr<uchar>(y);
+        for (int x = 0; x < luma.cols; x++) {
+            const uchar pixel[3] = {in[x], uv[x & ~1], uv[(x & ~1) + 1]};
+            uchar value = rule(pixel) ? 255 : 0;
+            out[x] = value;
+            kept[x] = region == nullptr || region[x] ? value : 0;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,112 @@
+/************************************************************************************************
+* @file      : Header file for PreviewRenderer class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The PreviewRenderer class shows the lanes of the detection in the preview windows on its
+*              own thread. It takes at most one frame per preview interval, draws the overlay on a
+*              downscaled copy and drops frames while it is busy, so it never holds up the detection.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <condition_variable>
+#include "opencv2/core.hpp"
+#include <opencv2/core/core.hpp>
+#include "LaneResult.hpp"
+#include "LaneStream.hpp"
+
+class PreviewRenderer {
+ public:
+    /***
+    *@brief  : Settings of the preview
+    *****/
+    struct Options {
+        double fps = 10;   // < Frames shown per second at most
+        int width = 640;   // < Width of the preview, 0 for the frame width
+        bool debug = false;   // < Also show the mask, edges and lines windows
+    };
+
+    /***
+    *@brief  : Constructor for PreviewRenderer class, which starts the
+    *          renderer thread
+    *****/
+    explicit PreviewRenderer(const Options& options);
+    ~PreviewRenderer() { stop(); }   // <Closes the windows and the thread
+
+    /***
+    *@brief  : The offer() function hands a frame to the renderer without
+    *          waiting. A frame within the preview interval of the last one
+    *          is ignored, and a frame the renderer has not taken yet is
+    *          replaced and counted as dropped.
+    *@params : frame is the frame before annotation, which the renderer only
+    *          reads, so the caller must not draw on it when it is taken
+    *@params : format is the PixelFormat of the frame
+    *@params : result is the lane result of the frame
+    *@params : stream gives the debug images, nullptr when the frame was not
+    *          detected
+    *@return : true if the renderer took the frame
+    *****/
+    bool offer(const cv::Mat& frame, int format, const LaneResult& result, \
+               const LaneStream *stream);
+
+    /***
+    *@brief  : The closed() function tells whether the user pressed Esc in a
+    *          preview window
+    *****/
+    bool closed() const { return escaped; }
+
+    /***
+    *@brief  : The stop() function shows no more frames, closes the windows
+    *          and joins the renderer thread
+    *****/
+    void stop();
+
+    /***
+    *@brief  : The report() function prints how many frames were shown and
+    *          dropped
+    *****/
+    void report(std::ostream& out) const;
+
+ private:
+    /***
+    *@brief  : The run() function is the body of the renderer thread
+    *****/
+    void run();
+
+    Options options;   // < Settings of the preview
+    cv::Mat frame;   // < Next frame to show
+    int format = 0;   // < PixelFormat of the next frame
+    LaneResult result;   // < Lane result of the next frame
+    cv::Mat mask, edges, lines;   // < Debug images of the next frame
+    bool pending = false;   // < Whether the slot holds a frame
+    bool stopping = false;   // < Set when no more frames will be offered
+    int64 lastOffer = 0;   // < Tick of the last frame taken
+    long shown = 0;   // < Frames shown
+    long dropped = 0;   // < Frames replaced before they were shown
+    std::atomic<bool> escaped{false};   // < Set when Esc was pressed
+    mutable std::mutex slotMutex;   // < Guards the slot and the counters
+    std::condition_variable ready;   // < Signalled on offer and stop
+    std::thread worker;   // < Renderer thread
+};
@@ -0,0 +1,118 @@
+/************************************************************************************************
+* @file      : Header file for RateController class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The RateController class keeps the lane detection in step with a live
+*              source. It watches the per-frame processing time against the frame
+*              interval of the source and, when the pipeline falls behind, steps down
+*              through a ladder of quality levels instead of accumulating lag:
+*                0.) Full quality;
+*                1.) Half the processing scale;
+*                2.) Coarser HoughLines rho and theta resolution;
+*                3.) No gaussian smoothing; and
+*                4.) Every other frame skipped, with the lanes extrapolated.
+*              Each level includes the degradations of the levels above it. When there
+*              is enough headroom the controller steps back up. Every transition and the
+*              time spent at each level are logged for tuning the CPU budgets.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <iostream>
+#include <vector>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+
+class RateController {
+ public:
+    /***
+    *@brief  : Default constructor for RateController class
+    *@params : fps is the frame rate of the source
+    *@params : log is the stream on which the level transitions are written
+    *@params : maxLevel is the lowest quality level the controller may use
+    *****/
+    RateController(double fps, std::ostream& log, int maxLevel = 4);
+    ~RateController() {}   // <Default destructor for RateController class
+
+    /***
+    *@brief  : The update() function feeds the processing time of one source
+    *          frame to the controller and changes the quality level if needed
+    *@params : seconds is the time spent on the frame
+    *****/
+    void update(double seconds);
+
+    /***
+    *@brief  : The skipFrame() function tells whether the next frame should skip
+    *          the detection and use extrapolated lanes instead
+    *****/
+    bool skipFrame();
+
+    /***
+    *@brief  : The extrapolateLane() function linearly extends the motion of the
+    *          polygon vertices between the two most recent detections
+    *@params : older is the polygon detected before the latest one
+    *@params : newer is the latest detected polygon
+    *@params : gap is the number of frames from older to newer
+    *@params : ahead is the number of frames from newer to the current frame
+    *@return : The predicted polygon for the current frame
+    *****/
+    static std::vector<cv::Point> extrapolateLane( \
+            const std::vector<cv::Point>& older, \
+            const std::vector<cv::Point>& newer, long gap = 1, \
+            long ahead = 1);
+
+    /***
+    *@brief  : The report() function writes the time and frames spent per level
+    *@params : out is the stream on which the statistics are written
+    *****/
+    void report(std::ostream& out) const;
+
+    int level() const { return currentLevel; }   // <Active quality level
+    double scaleFactor() const;   // <Factor applied to processing scale
+    double houghFactor() const;   // <Factor applied to Hough resolutions
+    bool smoothing() const;   // <Whether gaussian smoothing is applied
+
+ private:
+    /***
+    *@brief  : The changeLevel() function switches to a new level and logs it
+    *@params : newLevel is the quality level to switch to
+    *****/
+    void changeLevel(int newLevel);
+
+    std::ostream& logStream;   // < Stream for logging the level transitions
+    double budget;   // < Time available per source frame in seconds
+    int lowestLevel;   // < Lowest quality level allowed
+    int currentLevel = 0;   // < Active quality level
+    double average = 0;   // < Exponential moving average of frame time
+    int slowFrames = 0;   // < Consecutive frames over budget
+    int fastFrames = 0;   // < Consecutive frames with enough headroom
+    int cooldown = 0;   // < Frames to wait after a transition
+    long frames = 0;   // < Count of all frames
+    bool skipToggle = false;   // < Alternates skipped and processed frames
+    std::vector<double> levelSeconds;   // < Time spent per level
+    std::vector<long> levelFrames;   // < Frames spent per level
+    const double alpha = 0.1;   // < Weight of new samples in the average
+    const double headroom = 0.6;   // < Load below which we step up
+    const int patience = 5;   // < Slow frames before stepping down
+    const int recovery = 60;   // < Fast frames before stepping up
+    const int settle = 15;   // < Frames to wait after a transition
+};
@@ -29,6 +29,7 @@
 #include <vector>
 #include <string>
 #include <utility>
+#include <limits>
 #include "opencv2/core.hpp"
 #include "opencv2/opencv.hpp"
 #include <opencv2/core/core.hpp>
@@ -42,7 +43,13 @@
 
 class RegionMaker {
  public:
-    RegionMaker() {}  // <Default constructor
+    /***
+    *@brief  : Default constructor for RegionMaker class
+    *@params : top is the image row of the upper polygon edge
+    *@params : bottom is the image row of the lower polygon edge
+    *****/
+    RegionMaker(int top = 650, int bottom = 704) : \
+        topRow(top), bottomRow(bottom) {}
     ~RegionMaker() {}  // <Default destructor
 
     /***
@@ -50,7 +57,8 @@ class RegionMaker {
     *          polygon corners from an input matrix of points
     *@params : The parameter cv::Mat binaryPoints is an input image matrix with
     *          ones in HoughLine regions and zeros everywhere else
-    *@return : The output from this function is a vector of polygon points
+    *@return : The output from this function is a vector of polygon points. Every
+    *          call starts from scratch, so one RegionMaker can be kept per stream
     *****/
     std::vector<cv::Point> getPolygonVertices(cv::Mat binaryPoints);
 
@@ -59,8 +67,11 @@ class RegionMaker {
     cv::Point polyVertex2;  // <Variable for storing polygon top left corner
     cv::Point polyVertex3;  // <Variable for storing polygon top right corner
     cv::Point polyVertex4;  // <Variable for storing polygon bottom left corner
+    int topRow;  // <Image row of the upper polygon edge
+    int bottomRow;  // <Image row of the lower polygon edge
     double low = 0;  // <Minimum assumption for optimization problem
-    double high = 5000;  // <Maximum assumption for optimization problem
+    // Maximum assumption for optimization problem
+    double high = std::numeric_limits<double>::max();
     // Container for storing polygon vertices
     std::vector<cv::Point> polygonVertices;
 };
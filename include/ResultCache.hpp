@@ -0,0 +1,121 @@
+/************************************************************************************************
+* @file      : Header file for ResultCache class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ResultCache class keeps the lanes of processed inputs in a local directory, keyed by
+*              the content of the input, the detection settings and the engine version. The lanes are
+*              stored in chunks of frames together with the pipeline state at the end of each chunk, so
+*              a job reuses any cached chunks and only processes the others. The least recently used
+*              chunks are evicted when the directory outgrows its size cap.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "LaneResult.hpp"
+#include "LanePipeline.hpp"
+
+class ResultCache {
+ public:
+    /***
+    *@brief  : Constructor for ResultCache class
+    *@params : directory is the location of the cache, created when missing
+    *@params : capacity is the size cap of the cache in bytes
+    *@params : chunk is the number of frames stored together
+    *****/
+    ResultCache(const std::string& directory, uintmax_t capacity, \
+                long chunk = 1024);
+    ~ResultCache() {}   // <Default destructor for ResultCache class
+
+    /***
+    *@brief  : The contentHash() function hashes the bytes of an input file,
+    *          so that a renamed or copied clip keeps its cached results
+    *@params : path is the input file
+    *@params : hash receives the hash of the content and size of the file
+    *@return : false if the file cannot be read
+    *****/
+    static bool contentHash(const std::string& path, uint64_t& hash);
+
+    /***
+    *@brief  : The key() function names the cached results of a job
+    *@params : content is the contentHash() of the input
+    *@params : settings is the LanePipeline::settingsHash() of the job
+    *@params : format is the PixelFormat asked of the source, -1 for BGR
+    *@return : The key, in hexadecimal
+    *****/
+    std::string key(uint64_t content, uint64_t settings, int format) const;
+
+    /***
+    *@brief  : The find() function reads a cached chunk and marks it as used
+    *@params : key is the key() of the job
+    *@params : first is the index of the first frame of the chunk
+    *@params : results receives the lanes of the frames of the chunk
+    *@params : state receives the pipeline state after the chunk
+    *@return : false if the chunk is not cached
+    *****/
+    bool find(const std::string& key, long first, \
+              std::vector<LaneResult>& results, LanePipeline::State& state);
+
+    /***
+    *@brief  : The store() function caches a chunk. A chunk is complete
+    *          once both of its files are renamed into place.
+    *@params : key is the key() of the job
+    *@params : first is the index of the first frame of the chunk
+    *@params : results are the lanes of the frames of the chunk
+    *@params : state is the pipeline state after the chunk
+    *@return : false if the chunk cannot be written
+    *****/
+    bool store(const std::string& key, long first, \
+               const std::vector<LaneResult>& results, \
+               const LanePipeline::State& state);
+
+    /***
+    *@brief  : The complete() function records that a job reached the end of
+    *          its input after the given number of frames
+    *****/
+    void complete(const std::string& key, long frames);
+
+    /***
+    *@brief  : The frames() function tells whether every chunk of a job is
+    *          cached, in which case the input needs not be read
+    *@return : The frames of the input, -1 if any chunk is missing
+    *****/
+    long frames(const std::string& key) const;
+
+    /***
+    *@brief  : The evict() function removes the least recently used chunks
+    *          until the cache fits in its size cap
+    *@return : The number of chunks removed
+    *****/
+    int evict();
+
+    /***
+    *@brief  : The chunk() function returns the number of frames of a chunk
+    *****/
+    long chunk() const { return chunkFrames; }
+
+ private:
+    std::string directory;   // < Location of the cache
+    uintmax_t capacity;   // < Size cap of the cache in bytes
+    long chunkFrames;   // < Number of frames stored together
+};
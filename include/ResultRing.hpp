@@ -0,0 +1,95 @@
+/************************************************************************************************
+* @file      : Header file for ResultRing class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ResultRing class carries one LaneRecord per processed frame from the detector back
+*              to the process which published the frames. It mirrors the FrameRing: the detector
+*              creates the ring and never waits, a reader copies every record out of its slot.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <cstdint>
+#include <string>
+#include "LaneRecord.hpp"
+#include "RingLayout.hpp"
+#include "SharedSegment.hpp"
+
+class ResultRing {
+ public:
+    ResultRing() {}   // <Default constructor
+    ~ResultRing();   // <Closes a created ring and unmaps the segment
+
+    /***
+    *@brief  : The create() function creates an empty ring as its writer
+    *@params : name is the shared memory name of the ring
+    *@params : slots is the number of records the ring holds
+    *@return : true if the ring was created
+    *****/
+    bool create(const std::string& name, uint32_t slots);
+
+    /***
+    *@brief  : The publish() function writes a record into the next slot
+    *@params : record is the lanes of a frame, frameIndex is its frame sequence
+    *@params : timestampNs is the capture time of the frame
+    *****/
+    void publish(const LaneRecord& record, uint64_t timestampNs);
+
+    /***
+    *@brief  : The finish() function tells the readers that no record follows
+    *****/
+    void finish();
+
+    /***
+    *@brief  : The attach() function attaches to a ring as its reader
+    *@params : name is the shared memory name of the ring
+    *@return : true if the segment exists and holds a result ring
+    *****/
+    bool attach(const std::string& name);
+
+    /***
+    *@brief  : The next() function waits for the next record and copies it out
+    *@params : record receives the record
+    *@params : timestampNs receives the capture time of its frame
+    *@params : timeoutSeconds is how long to wait for a new record
+    *@return : false once the ring is finished and read or on a timeout
+    *****/
+    bool next(LaneRecord& record, uint64_t& timestampNs, double timeoutSeconds);
+
+    uint64_t dropped() const { return droppedRecords; }   // <Records overwritten unread
+    const std::string& error() const { return lastError; }   // <Last failure
+
+ private:
+    ResultRing(const ResultRing&) = delete;
+    ResultRing& operator=(const ResultRing&) = delete;
+
+    /***
+    *@brief  : The slotAt() function returns the slot of a sequence number
+    *****/
+    ResultSlot *slotAt(uint64_t sequence) const;
+
+    SharedSegment segment;   // < Mapping of the ring
+    ResultRingHeader *header = nullptr;   // < Start of the mapping
+    bool writer = false;   // < Whether this side created the ring
+    uint64_t nextSequence = 1;   // < Sequence next() reads next
+    uint64_t droppedRecords = 0;   // < Records overwritten unread
+    std::string lastError;   // < Description of the last failure
+};
@@ -0,0 +1,177 @@
+/************************************************************************************************
+* @file      : Header file for the result sinks
+* @author    : Arun Kumar Devarajulu
+* @brief     : A ResultSink receives the annotated frame and the LaneResult of every
+*              frame from the OutputWriter thread. Three sinks are provided:
+*                1.) VideoSink encodes the annotated frames with cv::VideoWriter at a
+*                    configurable path and codec;
+*                2.) CsvSink writes one line of lane geometry per frame and never needs
+*                    the image, so no video encoding happens at all; and
+*                3.) BinarySink writes one fixed size LaneRecord per frame into a
+*                    memory-mappable binary results file.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <string>
+#include <fstream>
+#include <ostream>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+#include "LaneResult.hpp"
+#include "LaneRecord.hpp"
+
+class ResultSink {
+ public:
+    virtual ~ResultSink() {}   // <Default destructor for ResultSink class
+
+    /***
+    *@brief  : The write() function consumes the output of one frame
+    *@params : frame is the annotated frame, empty when no sink needs images
+    *@params : result is the lane result of the frame
+    *****/
+    virtual void write(const cv::Mat& frame, const LaneResult& result) = 0;
+
+    /***
+    *@brief  : The needsFrame() function tells whether the sink uses the image
+    *****/
+    virtual bool needsFrame() const = 0;
+
+    /***
+    *@brief  : The close() function flushes and releases the sink
+    *****/
+    virtual void close() = 0;
+
+    /***
+    *@brief  : The position() function flushes the sink and returns the bytes
+    *          of its file so far, where a resumed job continues it
+    *@return : The file size, or -1 when the output cannot be continued
+    *****/
+    virtual long long position() { return -1; }
+
+    /***
+    *@brief  : The resumeFile() function cuts a file back to the position of a
+    *          checkpoint, dropping what was written after it
+    *@return : false if the file is shorter than the position
+    *****/
+    static bool resumeFile(const std::string& path, long long position);
+};
+
+class VideoSink : public ResultSink {
+ public:
+    /***
+    *@brief  : Default constructor for VideoSink class
+    *@params : path is the location of the output video file
+    *@params : codec is the four character code of the video codec
+    *@params : fps is the frame rate of the output video
+    *@params : size is the size of the output frames
+    *****/
+    VideoSink(const std::string& path, const std::string& codec, double fps, \
+              cv::Size size);
+    ~VideoSink() { close(); }
+
+    void write(const cv::Mat& frame, const LaneResult& result) override;
+    bool needsFrame() const override { return true; }
+    void close() override;
+
+ private:
+    cv::VideoWriter video;   // < Video writing object
+};
+
+class CsvSink : public ResultSink {
+ public:
+    /***
+    *@brief  : Default constructor for CsvSink class
+    *@params : path is the location of the output results file
+    *@params : resumeAt is the position() of a checkpoint: the file is cut
+    *          back to it and continued without a new header. -1 starts a
+    *          new file.
+    *****/
+    explicit CsvSink(const std::string& path, long long resumeAt = -1);
+    ~CsvSink() { close(); }
+
+    void write(const cv::Mat& frame, const LaneResult& result) override;
+    bool needsFrame() const override { return false; }
+    void close() override;
+    long long position() override;
+
+    /***
+    *@brief  : The writeRow() function writes the CSV row of a result, without
+    *          the line break, in the column order of the results file
+    *@params : out is the stream to write to, it should use fixed notation
+    *@params : result is the lane result of a frame
+    *****/
+    static void writeRow(std::ostream& out, const LaneResult& result);
+
+ private:
+    std::ofstream resultsFile;   // < Output results file
+};
+
+class BinarySink : public ResultSink {
+ public:
+    /***
+    *@brief  : Default constructor for BinarySink class
+    *@params : path is the location of the output results file
+    *@params : header is the file header written before the first record
+    *@params : resumeAt is the position() of a checkpoint: the file is cut
+    *          back to it and continued without a new header. -1 starts a
+    *          new file.
+    *****/
+    BinarySink(const std::string& path, const LaneFileHeader& header, \
+               long long resumeAt = -1);
+    ~BinarySink() { close(); }
+
+    void write(const cv::Mat& frame, const LaneResult& result) override;
+    bool needsFrame() const override { return false; }
+    void close() override;
+    long long position() override;
+
+    /***
+    *@brief  : The makeHeader() function fills a file header for a detection run
+    *@params : frame is the size of the input frames
+    *@params : camParams is the camera matrix
+    *@params : distCoeffs is the distortion coefficients
+    *@params : wMin, wMax, yMin, yMax are the white and yellow thresholds
+    *@params : processScale is the processing scale of the detection
+    *****/
+    static LaneFileHeader makeHeader(cv::Size frame, cv::Mat camParams, \
+                                     cv::Mat distCoeffs, cv::Scalar wMin, \
+                                     cv::Scalar wMax, cv::Scalar yMin, \
+                                     cv::Scalar yMax, double processScale);
+
+    /***
+    *@brief  : The toRecord() function packs a lane result into a record
+    *@params : result is the lane result of a frame
+    *****/
+    static LaneRecord toRecord(const LaneResult& result);
+
+    /***
+    *@brief  : The toResult() function unpacks a record into a lane result
+    *@params : record is the stored record of a frame
+    *****/
+    static LaneResult toResult(const LaneRecord& record);
+
+ private:
+    std::ofstream resultsFile;   // < Output results file
+};
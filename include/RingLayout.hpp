@@ -0,0 +1,97 @@
+/************************************************************************************************
+* @file      : Shared memory layout of the frame and result rings
+* @author    : Arun Kumar Devarajulu
+* @brief     : The frame ring carries raw frames from a capture process to the detector and
+*              the result ring carries one LaneRecord per processed frame back. Both live in
+*              POSIX shared memory and are made of a header followed by a fixed number of
+*              slots. Every slot starts with a sequence number which works as a seqlock: the
+*              writer marks the slot busy, writes it and then stores the sequence number of
+*              the new content. A reader which finds a different sequence number after
+*              reading knows that the slot was overwritten underneath it. The writers never
+*              wait for the readers, a slow reader loses the oldest frames instead. This
+*              header only needs the C++ standard library so that producers can use it
+*              without OpenCV.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include "LaneRecord.hpp"
+
+// Magic bytes at the start of a frame ring
+static const char kFrameRingMagic[8] = {'L', 'A', 'N', 'E', 'F', 'R', 'M', '1'};
+// Magic bytes at the start of a result ring
+static const char kResultRingMagic[8] = {'L', 'A', 'N', 'E', 'R', 'E', 'S', '1'};
+// Version of both ring layouts
+static const uint32_t kRingVersion = 1;
+// Sequence number of a slot while it is being written
+static const uint64_t kSlotBusy = UINT64_MAX;
+
+struct FrameRingHeader {
+    char magic[8];   // < Always kFrameRingMagic
+    uint32_t version;   // < Always kRingVersion
+    uint32_t headerSize;   // < Size of this header in bytes
+    uint32_t slotCount;   // < Number of frame slots
+    uint32_t slotBytes;   // < Pixel capacity of one slot in bytes
+    uint64_t slotStride;   // < Bytes from one slot to the next
+    std::atomic<uint64_t> published;   // < Sequence of the newest frame
+    std::atomic<uint32_t> closed;   // < Set after the last frame
+    uint32_t reserved0;   // < Padding, always zero
+    uint8_t reserved[80];   // < Room for future fields, always zero
+};
+
+struct FrameSlot {
+    std::atomic<uint64_t> sequence;   // < Frame sequence, starting at one
+    uint64_t timestampNs;   // < Capture time in nanoseconds
+    int32_t width;   // < Frame width in pixels
+    int32_t height;   // < Frame height in pixels
+    int32_t stride;   // < Bytes from one row to the next
+    int32_t format;   // < Pixel layout as a PixelFormat
+    uint8_t reserved[32];   // < Room for future fields, the pixels follow
+};
+
+struct ResultRingHeader {
+    char magic[8];   // < Always kResultRingMagic
+    uint32_t version;   // < Always kRingVersion
+    uint32_t headerSize;   // < Size of this header in bytes
+    uint32_t slotCount;   // < Number of result slots
+    uint32_t recordSize;   // < Size of one LaneRecord in bytes
+    std::atomic<uint64_t> published;   // < Sequence of the newest result
+    std::atomic<uint32_t> closed;   // < Set after the last result
+    uint32_t reserved0;   // < Padding, always zero
+    uint8_t reserved[24];   // < Room for future fields, always zero
+};
+
+struct ResultSlot {
+    std::atomic<uint64_t> sequence;   // < Result sequence, starting at one
+    uint64_t timestampNs;   // < Capture time of the frame
+    LaneRecord record;   // < Lanes, frameIndex is the frame sequence
+};
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, \
+              "the rings need lock-free 64 bit atomics");
+static_assert(sizeof(FrameRingHeader) == 128, "FrameRingHeader must be 128 bytes");
+static_assert(sizeof(FrameSlot) == 64, "FrameSlot must be 64 bytes");
+static_assert(sizeof(ResultRingHeader) == 64, "ResultRingHeader must be 64 bytes");
+static_assert(sizeof(ResultSlot) == 112, "ResultSlot must be 112 bytes");
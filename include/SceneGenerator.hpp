@@ -0,0 +1,144 @@
+/************************************************************************************************
+* @file      : Header file for SceneGenerator class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The SceneGenerator class renders synthetic road frames together with the true lane
+*              positions, so that tests and benchmarks do not need recorded footage. The road is a
+*              flat plane seen through the camera of a LaneConfig: lanes, dashes and shadows are
+*              drawn in undistorted image co-ordinates and the frame is then distorted with the
+*              camera model that the Cleaner class removes again. Every frame only depends on the
+*              settings and its index, so any resolution and any number of streams can be made
+*              again bit for bit.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <string>
+#include <vector>
+#include "opencv2/core.hpp"
+#include "opencv2/opencv.hpp"
+#include <opencv2/core/core.hpp>
+#include "FrameSource.hpp"
+#include "LaneConfig.hpp"
+
+struct SceneTruth {
+    long frameIndex = 0;   // < Index of the frame
+    std::vector<cv::Point2d> left;   // < Centre of the left marking, top down
+    std::vector<cv::Point2d> right;   // < Centre of the right marking, top down
+
+    /***
+    *@brief  : The xAt() function interpolates the column of a lane at a row
+    *@params : lane is one of the lanes of the truth
+    *@params : row is the image row in undistorted co-ordinates
+    *@return : The column, or NaN when the row is above or below the lane
+    *****/
+    static double xAt(const std::vector<cv::Point2d>& lane, double row);
+};
+
+class SceneGenerator {
+ public:
+    struct Marking {
+        bool dashed;   // < Dashed instead of solid
+        bool yellow;   // < Yellow instead of white
+    };
+
+    struct Settings {
+        cv::Size size = cv::Size(1280, 720);   // < Frame resolution
+        double curvature = 0;   // < Lane shift at the horizon, fraction of width
+        Marking left = Marking{false, true};   // < Left lane marking
+        Marking right = Marking{true, false};   // < Right lane marking
+        int shadows = 0;   // < Shadows lying across the road
+        double noise = 0;   // < Standard deviation of the pixel noise
+        bool distort = true;   // < Apply the lens distortion of the camera
+        double speed = 0.05;   // < Dash periods driven per frame
+        unsigned seed = 1;   // < Seed of the shadows and the noise
+        LaneConfig camera;   // < Camera matrix, distortion and calibration
+    };
+
+    /***
+    *@brief  : Default constructor for SceneGenerator class, builds the lens
+    *          distortion map of the resolution
+    *@params : settings describe the road, the markings and the camera
+    *****/
+    explicit SceneGenerator(const Settings& settings);
+    ~SceneGenerator() {}   // <Default destructor for SceneGenerator class
+
+    /***
+    *@brief  : The render() function draws a frame of the drive
+    *@params : frameIndex is the index of the frame
+    *@params : truth receives the lane centres in undistorted co-ordinates,
+    *          which is where the detector reports its lanes
+    *@return : The BGR frame
+    *****/
+    cv::Mat render(long frameIndex, SceneTruth& truth) const;
+
+    /***
+    *@brief  : The readMarking() function reads a lane marking from the words
+    *          "solid", "dashed", "white" and "yellow", such as "dashed-yellow"
+    *@params : text holds the words, any missing word keeps the fallback
+    *@params : fallback is the marking to start from
+    *****/
+    static Marking readMarking(const std::string& text, Marking fallback);
+
+    const Settings& settings() const { return options; }   // <Scene settings
+
+ private:
+    /***
+    *@brief  : The laneColumn() function returns the column of a point of the
+    *          road in undistorted co-ordinates
+    *@params : offset is the column of the point on the bottom row, relative to
+    *          the vanishing point
+    *@params : depth is the row position between horizon (0) and bottom (1)
+    *****/
+    double laneColumn(double offset, double depth) const;
+
+    Settings options;   // < Scene settings
+    double vanishX;   // < Column of the vanishing point
+    double vanishY;   // < Row of the horizon
+    cv::Mat distortX, distortY;   // < Undistorted position of every pixel
+};
+
+class SceneSource : public FrameSource {
+ public:
+    /***
+    *@brief  : Default constructor for SceneSource class
+    *@params : settings describe the road, the markings and the camera
+    *@params : frames is the number of frames of the drive
+    *@params : rate is the frame rate reported for the drive
+    *****/
+    SceneSource(const SceneGenerator::Settings& settings, long frames, \
+                double rate = 30);
+
+    bool isOpened() const override { return frameCount > 0; }
+    bool read(cv::Mat& frame) override;
+    cv::Size frameSize() const override { return generator.settings().size; }
+    double fps() const override { return frameRate; }
+    void release() override { nextFrame = frameCount; }
+
+    const SceneTruth& truth() const { return lastTruth; }   // <Last frame
+
+ private:
+    SceneGenerator generator;   // < Renders the frames
+    long frameCount;   // < Frames of the drive
+    long nextFrame = 0;   // < Index read() renders next
+    double frameRate;   // < Reported frame rate
+    SceneTruth lastTruth;   // < Lanes of the last frame read
+};
@@ -0,0 +1,72 @@
+/************************************************************************************************
+* @file      : Header file for SharedSegment class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The SharedSegment class creates or attaches to a named POSIX shared memory
+*              segment and maps it into the process. The process which creates a segment
+*              owns it and removes its name again when the segment is closed.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <string>
+#include <cstddef>
+
+class SharedSegment {
+ public:
+    SharedSegment() {}   // <Default constructor
+    ~SharedSegment() { close(); }   // <Unmaps and, if owned, removes the segment
+
+    /***
+    *@brief  : The create() function creates a zero filled segment, replacing a
+    *          stale segment of the same name
+    *@params : name is the segment name, a leading slash is added when missing
+    *@params : bytes is the size of the segment
+    *@return : true if the segment was created and mapped
+    *****/
+    bool create(const std::string& name, size_t bytes);
+
+    /***
+    *@brief  : The attach() function maps an existing segment as a whole
+    *@params : name is the segment name, a leading slash is added when missing
+    *@return : true if the segment exists and was mapped
+    *****/
+    bool attach(const std::string& name);
+
+    /***
+    *@brief  : The close() function unmaps the segment
+    *****/
+    void close();
+
+    void *data() const { return base; }   // <Start of the mapping
+    size_t size() const { return mappedBytes; }   // <Length of the mapping
+    const std::string& error() const { return lastError; }   // <Last failure
+
+ private:
+    SharedSegment(const SharedSegment&) = delete;
+    SharedSegment& operator=(const SharedSegment&) = delete;
+
+    std::string segmentName;   // < Name with the leading slash
+    void *base = nullptr;   // < Start of the mapping
+    size_t mappedBytes = 0;   // < Length of the mapping
+    bool owner = false;   // < Whether close() removes the name
+    std::string lastError;   // < Description of the last failure
+};
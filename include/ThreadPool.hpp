@@ -0,0 +1,104 @@
+/************************************************************************************************
+* @file      : Header file for ThreadPool class
+* @author    : Arun Kumar Devarajulu
+* @brief     : The ThreadPool class runs tasks on a fixed set of worker threads with work
+*              stealing: every worker has its own task queue, takes its newest task first
+*              and steals the oldest task of another worker when its own queue is empty.
+*              A task submitted from a worker goes to the queue of that worker, so a task
+*              which schedules its own continuation (one video stream processing its next
+*              frame) tends to stay on the same core while idle workers pick up the others.
+* @date      : October 19, 2026
+* @copyright : 2018, Arun Kumar Devarajulu
+* @license   : MIT License
+*
+*              Permission is hereby granted, free of charge, to any person obtaining a copy
+*              of this software and associated documentation files (the "Software"), to deal
+*              in the Software without restriction, including without limitation the rights
+*              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+*              copies of the Software, and to permit persons to whom the Software is
+*              furnished to do so, subject to the following conditions:
+*
+*              The above copyright notice and this permission notice shall be included in all
+*              copies or substantial portions of the Software.
+*
+*              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+*              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+*              FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+*              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+*              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+*              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+*              SOFTWARE.
+*************************************************************************************************/
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+ public:
+    /***
+    *@brief  : Default constructor for ThreadPool class, starts the workers
+    *@params : workers is the number of threads, at least one
+    *@params : cores are the cores the workers are pinned to, one core each
+    *          in turn, or none to let them run anywhere
+    *****/
+    explicit ThreadPool(int workers, \
+                        const std::vector<int>& cores = std::vector<int>());
+
+    /***
+    *@brief  : The destructor waits for all the tasks and joins the workers
+    *****/
+    ~ThreadPool();
+
+    /***
+    *@brief  : The submit() function queues a task. Tasks must not throw.
+    *@params : task is the function to run on one of the workers
+    *****/
+    void submit(std::function<void()> task);
+
+    /***
+    *@brief  : The wait() function blocks until every submitted task, including
+    *          the ones submitted by running tasks, has finished
+    *****/
+    void wait();
+
+    int size() const { return static_cast<int>(threads.size()); }
+    size_t steals() const { return stealCount; }   // <Tasks taken from others
+
+ private:
+    /***
+    *@brief  : Task queue of one worker
+    *****/
+    struct Queue {
+        std::mutex lock;   // < Guards the tasks
+        std::deque<std::function<void()>> tasks;   // < Oldest task first
+    };
+
+    /***
+    *@brief  : The work() function is the body of every worker
+    *@params : self is the index of the queue owned by the worker
+    *****/
+    void work(size_t self, int core);
+
+    /***
+    *@brief  : The take() function pops the newest task of the own queue or
+    *          steals the oldest task of another queue
+    *****/
+    bool take(size_t self, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<Queue>> queues;   // < One queue per worker
+    std::vector<std::thread> threads;   // < Worker threads
+    std::mutex stateMutex;   // < Guards the counters and stopping
+    std::condition_variable taskQueued;   // < Wakes up idle workers
+    std::condition_variable allDone;   // < Signalled when nothing is pending
+    size_t queued = 0;   // < Tasks waiting in the queues
+    size_t pending = 0;   // < Tasks queued or running
+    bool stopping = false;   // < Set when the workers must exit
+    std::atomic<size_t> nextQueue;   // < Round robin queue for outside tasks
+    std::atomic<size_t> stealCount;   // < Number of stolen tasks
+};
@@ -37,6 +37,7 @@
 #include "opencv2/imgproc/imgproc_c.h"
 #include "opencv2/calib3d.hpp"
 #include "opencv2/imgcodecs.hpp"
+#include "PixelStages.hpp"
 
 class Thresholder {
  public:
@@ -79,6 +80,73 @@ class Thresholder {
     *******/
     cv::Mat combineLanes();
 
+    // White or yellow, as one rule on L*a*b pixels. A further color range
+    // is one more PixelRange here and in laneRule().
+    typedef PixelAnyOf<PixelRange<uchar, 3>, PixelRange<uchar, 3> > LaneRule;
+
+    /****
+    *@brief  : The laneRule() function returns the white and yellow thresholds
+    *          as a rule for fuseMask()
+    *******/
+    LaneRule laneRule() const;
+
+    /****
+    *@brief  : The maskRows() function gives the same lanes mask as
+    *          convertToLab(), both masks and combineLanes(), and the lanes
+    *          within the region of interest, in one fused pass without any
+    *          intermediate image, so bands of a frame may be masked in
+    *          parallel
+    *@params : bgr is the smoothed 8 bit BGR image, such as a band of rows;
+    *          any other layout is an error
+    *@params : roi is the region of interest of the rows
+    *@params : lanes receives the combined lanes mask
+    *@params : interest receives the lanes within the region of interest
+    *******/
+    void maskRows(const cv::Mat& bgr, const cv::Mat& roi, cv::Mat& lanes, \
+                  cv::Mat& interest) const;
+
+    /****
+    *@brief  : The yuvBounds() function derives Y, U, V thresholds from an
+    *          L*a*b range. Colors of a grid over the whole BGR cube are
+    *          labeled by the L*a*b range, and the Y, U, V box which overlaps
+    *          best with the labeled colors is kept. The box can only
+    *          approximate the range, since L*a*b is not linear in Y, U, V.
+    *@params : labMin and labMax are the L*a*b range
+    *@params : yuvMin and yuvMax receive the Y, U, V range of NV12 frames,
+    *          with yuvMin above yuvMax when no color is in the range
+    *@return : The intersection over union of the colors in both ranges
+    *******/
+    static double yuvBounds(const cv::Scalar& labMin, \
+                            const cv::Scalar& labMax, cv::Scalar& yuvMin, \
+                            cv::Scalar& yuvMax);
+
+    /****
+    *@brief  : The calibrateYuv() function derives the Y, U, V thresholds of
+    *          the white and yellow lanes from their L*a*b thresholds. It only
+    *          runs once, on the first call.
+    *******/
+    void calibrateYuv();
+
+    /****
+    *@brief  : The yuvRule() function returns the calibrated white and yellow
+    *          thresholds as a rule on Y, U, V pixels
+    *******/
+    LaneRule yuvRule() const;
+
+    /****
+    *@brief  : The maskNv12() function masks the lanes of the two planes of an
+    *          NV12 frame like maskRows() masks a BGR image, without any color
+    *          conversion. calibrateYuv() must have run.
+    *@params : luma is the luminance plane
+    *@params : chroma is the interleaved U, V plane at half resolution
+    *@params : roi, lanes and interest are those of maskRows()
+    *******/
+    void maskNv12(const cv::Mat& luma, const cv::Mat& chroma, \
+                  const cv::Mat& roi, cv::Mat& lanes, \
+                  cv::Mat& interest) const;
+
+    bool yuvCalibrated() const { return calibrated; }   // <Y, U, V bounds set
+
  private:
     cv::Mat inputImg;   // < Container used for storing input image
     const cv::Scalar whiteMin;   // < Minimum threshold for white lane
@@ -89,4 +157,9 @@ class Thresholder {
     cv::Mat yellowMask;   // < Container for yellow lanes
     cv::Mat lanesMask;   // < Container for all lanes combined
     cv::Mat labImage;   // < Container for LAB converted input image
+    cv::Scalar whiteYuvMin;   // < Minimum Y, U, V threshold for white lane
+    cv::Scalar whiteYuvMax;   // < Maximum Y, U, V threshold for white lane
+    cv::Scalar yellowYuvMin;   // < Minimum Y, U, V threshold for yellow lane
+    cv::Scalar yellowYuvMax;   // < Maximum Y, U, V threshold for yellow lane
+    bool calibrated = false;   // < Whether calibrateYuv() has run
 };
@@ -3,9 +3,9 @@
 *              using OpenCV and C++
 * @author    : Arun Kumar Devarajulu
 * @brief     : The following lines of code tests all the classes and their functions
-*              which are located in ../app/ and ../include/ directories. Diles.cpp is
-*              excluded from testing because it interfaces with system dependencies
-*              which cannot be tested.
+*              which are located in ../app/ and ../include/ directories. The prompts in
+*              Files.cpp are excluded from testing because they interface with system
+*              dependencies which cannot be tested.
 * @date      : October 16, 2018
 * @copyright : 2018, Arun Kumar Devarajulu
 * @license   : MIT License
@@ -28,11 +28,53 @@
 *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 *              SOFTWARE.
 *************************************************************************************************/
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include "gtest/gtest.h"
 #include "Cleaner.hpp"
 #include "Thresholder.hpp"
 #include "LanesMarker.hpp"
 #include "RegionMaker.hpp"
+#include "Arguments.hpp"
+#include "ChangeDetector.hpp"
+#include "LaneGeometry.hpp"
+#include "RateController.hpp"
+#include "OutputWriter.hpp"
+#include "LaneRecordReader.hpp"
+#include "ImageSequenceSource.hpp"
+#include "Files.hpp"
+#include "FrameEnumerator.hpp"
+#include "LaneConfig.hpp"
+#include "LaneStream.hpp"
+#include "ThreadPool.hpp"
+#include "LanePipeline.hpp"
+#include "FrameRing.hpp"
+#include "ResultRing.hpp"
+#include "LaneServer.hpp"
+#include "FrameCacheSource.hpp"
+#include "SceneGenerator.hpp"
+#include "LaneRegression.hpp"
+#include "LaneTuner.hpp"
+#include "PixelStages.hpp"
+#include "LaneFitter.hpp"
+#include "Checkpoint.hpp"
+#include "ResultCache.hpp"
+#include "CoreScheduler.hpp"
 #include "opencv2/core.hpp"
 #include "opencv2/opencv.hpp"
 #include <opencv2/core/core.hpp>
@@ -67,6 +109,50 @@ TEST(CleanerTest, UndistortAndBlurTest) {
     std::cout << "Undistort and smoothen outputs are good" << std::endl;
 }
 
+TEST(CleanerTest, BirdsEyeTest) {
+    Cleaner CleanerObj((cv::Mat_<double>(3, 3) << 1.15422732e+03, \
+                        0.00000000e+00, 6.71627794e+02, 0.00000000e+00, \
+                        1.14818221e+03, 3.86046312e+02, 0.00000000e+00, \
+                        0.00000000e+00, 1.00000000e+00),  \
+                       (cv::Mat_<double>(1, 8) << -2.42565104e-01, \
+                        -4.77893070e-02, -1.31388084e-03, \
+                        -8.79107779e-05, 2.20573263e-02, 0, 0, 0));
+    cv::Mat sampleImg(720, 1280, CV_8UC1);
+    for (int col = 0; col < sampleImg.cols; ++col) {
+        sampleImg.col(col).setTo(cv::Scalar(col * 255 / (sampleImg.cols - 1)));
+    }
+    std::vector<cv::Point2f> roadQuad = {cv::Point2f(560, 450), \
+                                         cv::Point2f(720, 450), \
+                                         cv::Point2f(1100, 690), \
+                                         cv::Point2f(200, 690)};
+    CleanerObj.setBirdsEye(roadQuad, cv::Size(160, 240));
+    ASSERT_TRUE(CleanerObj.hasBirdsEye());
+
+    // One composite remap matches undistorting and then warping the frame
+    cv::Mat view, twoPass;
+    CleanerObj.birdsEye(sampleImg, view);
+    CleanerObj.imgUndistort(sampleImg);
+    cv::warpPerspective(CleanerObj.getUndistorted(), twoPass, \
+                        CleanerObj.viewHomography(), view.size());
+    EXPECT_EQ(cv::Size(160, 240), view.size());
+    EXPECT_LE(cv::norm(view, twoPass, cv::NORM_INF), 1);
+
+    // The road corners are the view corners and map back onto the frame
+    auto viewCorners = CleanerObj.frameToView(roadQuad);
+    EXPECT_NEAR(160, viewCorners[2].x, 1e-2);
+    EXPECT_NEAR(240, viewCorners[2].y, 1e-2);
+    auto frameCorners = CleanerObj.viewToFrame(viewCorners);
+    for (size_t i = 0; i < roadQuad.size(); ++i) {
+        EXPECT_NEAR(roadQuad[i].x, frameCorners[i].x, 1e-2);
+        EXPECT_NEAR(roadQuad[i].y, frameCorners[i].y, 1e-2);
+    }
+    cv::Mat frame;
+    CleanerObj.viewToFrame(view, sampleImg.size(), frame);
+    EXPECT_EQ(CleanerObj.getUndistorted().at<uchar>(600, 640), \
+              frame.at<uchar>(600, 640));
+    EXPECT_EQ(0, frame.at<uchar>(100, 100));
+}
+
 /***************************************
 *
 *  Next we test the Thresholder class
@@ -96,6 +182,42 @@ TEST(ThresholderTest, LabAndMaskTest) {
     std::cout << "Combine lanes output is good" << std::endl;
 }
 
+TEST(ThresholderTest, Nv12MaskTest) {
+    // Road, white, yellow and pure white columns on even co-ordinates
+    cv::Mat bgr(48, 64, CV_8UC3, cv::Scalar(100, 100, 100));
+    bgr(cv::Rect(8, 0, 8, 48)).setTo(cv::Scalar(235, 235, 235));
+    bgr(cv::Rect(24, 0, 8, 48)).setTo(cv::Scalar(40, 210, 240));
+    bgr(cv::Rect(40, 0, 8, 48)).setTo(cv::Scalar(255, 255, 255));
+    cv::Mat frame = LanePipeline::nv12(bgr);
+    FrameView view = LanePipeline::view(frame, PIXEL_NV12);
+    EXPECT_EQ(48, view.height);
+    EXPECT_EQ(72, LanePipeline::wrap(view).rows);
+    EXPECT_LE(cv::norm(LanePipeline::bgr(frame, PIXEL_NV12), bgr, \
+                       cv::NORM_INF), 2);
+
+    cv::Scalar yuvMin, yuvMax;
+    EXPECT_GT(Thresholder::yuvBounds(cv::Scalar(198, 0, 0), \
+                                     cv::Scalar(255, 255, 255), yuvMin, \
+                                     yuvMax), 0.5);
+    EXPECT_GT(yuvMin[0], 128);
+    EXPECT_EQ(255, yuvMax[0]);
+
+    // The planes give the lanes of the L*a*b thresholds
+    Thresholder thresholdObj(cv::Scalar(198, 0, 0), \
+                             cv::Scalar(255, 255, 255), \
+                             cv::Scalar(165, 130, 130), \
+                             cv::Scalar(255, 255, 255));
+    thresholdObj.calibrateYuv();
+    ASSERT_TRUE(thresholdObj.yuvCalibrated());
+    cv::Mat labLanes, labInside, yuvLanes, yuvInside;
+    thresholdObj.maskRows(bgr, cv::Mat(), labLanes, labInside);
+    thresholdObj.maskNv12(frame.rowRange(0, 48), \
+                          frame.rowRange(48, 72).reshape(2), cv::Mat(), \
+                          yuvLanes, yuvInside);
+    EXPECT_EQ(3 * 8 * 48, cv::countNonZero(labLanes));
+    EXPECT_EQ(0, cv::norm(labLanes, yuvLanes, cv::NORM_INF));
+}
+
 /*********************************************
 *
 *  Later we test the LanesMarker class
@@ -132,3 +254,1179 @@ TEST(RegionMakerTest, PolygonTest) {
     EXPECT_EQ(typeid(std::vector<cv::Point>).name(), \
               typeid(polyVecType).name());
 }
+
+/************************************************
+*
+*  Next we test the Arguments class
+*
+*************************************************/
+TEST(ArgumentsTest, OptionsAndPositionalTest) {
+    char arg0[] = "shell-app";
+    char arg1[] = "--gate";
+    char arg2[] = "video.mp4";
+    char arg3[] = "--gate-threshold=3.5";
+    char *argv[] = {arg0, arg1, arg2, arg3};
+    Arguments argsObj(4, argv);
+
+    EXPECT_TRUE(argsObj.has("gate"));
+    EXPECT_FALSE(argsObj.has("gate-stats"));
+    EXPECT_EQ(1u, argsObj.positional().size());
+    EXPECT_EQ(std::string("video.mp4"), argsObj.positional().front());
+    EXPECT_DOUBLE_EQ(3.5, argsObj.getDouble("gate-threshold", 2.0));
+    EXPECT_EQ(15, argsObj.getInt("gate-max-reuse", 15));
+}
+
+/************************************************
+*
+*  Later we test the ChangeDetector class
+*
+*************************************************/
+TEST(ChangeDetectorTest, GateAndReuseLimitTest) {
+    std::vector<cv::Point> roi = {cv::Point(10, 10), cv::Point(90, 10), \
+                                  cv::Point(90, 90), cv::Point(10, 90)};
+    ChangeDetector gateObj(roi, 2.0, 2);
+    cv::Mat still = cv::Mat(100, 100, CV_8UC3, cv::Scalar(60, 60, 60));
+    cv::Mat moved = cv::Mat(100, 100, CV_8UC3, cv::Scalar(160, 160, 160));
+
+    // The very first frame always needs the full pipeline
+    EXPECT_FALSE(gateObj.isUnchanged(still));
+    EXPECT_TRUE(gateObj.isUnchanged(still));
+    EXPECT_TRUE(gateObj.isUnchanged(still));
+    // The reuse limit forces a new detection even on a static scene
+    EXPECT_FALSE(gateObj.isUnchanged(still));
+    // A large change always needs the full pipeline
+    EXPECT_FALSE(gateObj.isUnchanged(moved));
+
+    EXPECT_EQ(5, gateObj.framesSeen());
+    EXPECT_EQ(2, gateObj.framesReused());
+}
+
+/************************************************
+*
+*  Next we test the LaneGeometry class
+*
+*************************************************/
+TEST(LaneGeometryTest, NormalizedConstantsAndScaleTest) {
+    LaneGeometry geometryObj(0.5);
+    cv::Size reference(1280, 720);
+
+    // On the reference resolution we get back the original pixel constants
+    auto roi = geometryObj.roiPolygon(reference);
+    EXPECT_EQ(cv::Point(527, 491), roi.at(0));
+    EXPECT_EQ(cv::Point(281, 704), roi.at(3));
+    EXPECT_EQ(650, geometryObj.polygonTopRow(reference));
+    EXPECT_EQ(704, geometryObj.polygonBottomRow(reference));
+    EXPECT_EQ(550, geometryObj.horizonRow(reference));
+    EXPECT_DOUBLE_EQ(1500.0, geometryObj.lineExtent(reference));
+
+    cv::Mat sampleImg = cv::Mat::ones(720, 1280, CV_8UC3);
+    auto smallImg = geometryObj.downscale(sampleImg);
+    EXPECT_EQ(cv::Size(640, 360), smallImg.size());
+
+    std::vector<cv::Point> smallPoints = {cv::Point(100, 300)};
+    auto framePoints = geometryObj.toFrame(smallPoints, smallImg.size(), \
+                                           reference);
+    EXPECT_EQ(cv::Point(200, 600), framePoints.at(0));
+}
+
+/************************************************
+*
+*  Next we test the RateController class
+*
+*************************************************/
+TEST(RateControllerTest, StepDownAndUpTest) {
+    std::ostringstream log;
+    RateController rateObj(25.0, log);
+    EXPECT_EQ(0, rateObj.level());
+
+    // Twice the frame budget of 40 ms pushes the quality down
+    for (int i = 0; i < 200; i++) {
+        rateObj.update(0.080);
+    }
+    EXPECT_EQ(4, rateObj.level());
+    EXPECT_FALSE(rateObj.smoothing());
+    EXPECT_DOUBLE_EQ(0.5, rateObj.scaleFactor());
+    EXPECT_TRUE(rateObj.skipFrame() != rateObj.skipFrame());
+
+    // Plenty of headroom brings the quality back up
+    for (int i = 0; i < 1000; i++) {
+        rateObj.update(0.005);
+    }
+    EXPECT_EQ(0, rateObj.level());
+    EXPECT_FALSE(log.str().empty());
+
+    // The motion per frame is extended, also when the detections are two
+    // frames apart on the lowest level
+    std::vector<cv::Point> older = {cv::Point(10, 10)};
+    std::vector<cv::Point> newer = {cv::Point(14, 12)};
+    EXPECT_EQ(cv::Point(18, 14), \
+              RateController::extrapolateLane(older, newer).at(0));
+    EXPECT_EQ(cv::Point(16, 13), \
+              RateController::extrapolateLane(older, newer, 2, 1).at(0));
+
+    // The log keeps its number format
+    std::ostringstream untouched;
+    RateController formats(30, untouched, 1);
+    for (int i = 0; i < 200; i++)
+        formats.update(0.2);
+    ASSERT_EQ(1, formats.level());
+    untouched << 2.25;
+    EXPECT_NE(std::string::npos, untouched.str().find("2.25"));
+}
+
+/************************************************
+*
+*  Next we test the OutputWriter class
+*
+*************************************************/
+TEST(OutputWriterTest, ResultsOnlyTest) {
+    const char *resultsPath = "OutputWriterTest.csv";
+    {
+        OutputWriter writerObj(2);
+        writerObj.addSink(std::unique_ptr<ResultSink>(new CsvSink( \
+                          resultsPath)));
+        EXPECT_FALSE(writerObj.needsFrame());
+        for (int i = 0; i < 10; i++) {
+            LaneResult result;
+            result.frameIndex = i;
+            result.polygon = {cv::Point(1, 2), cv::Point(3, 4), \
+                              cv::Point(5, 6), cv::Point(7, 8)};
+            result.turn = TURN_LEFT;
+            writerObj.push(cv::Mat(), result);
+        }
+        writerObj.close();
+        // Once closed, pushes are dropped and nothing waits for the writer
+        LaneResult late;
+        late.frameIndex = 10;
+        writerObj.push(cv::Mat(), late);
+        EXPECT_EQ(1u, writerObj.positions().size());
+    }
+
+    std::ifstream resultsFile(resultsPath);
+    std::string line;
+    int lines = 0;
+    while (std::getline(resultsFile, line)) {
+        lines++;
+    }
+    // One header line plus one line per frame, in order
+    EXPECT_EQ(11, lines);
+    EXPECT_NE(std::string::npos, line.find("left"));
+    EXPECT_EQ(0u, line.find("9,"));
+    std::remove(resultsPath);
+}
+
+/************************************************
+*
+*  Next we test the binary results format
+*
+*************************************************/
+TEST(LaneRecordReaderTest, WriteAndMapTest) {
+    const char *resultsPath = "LaneRecordReaderTest.lres";
+    cv::Mat camParams = cv::Mat::eye(3, 3, CV_64F);
+    cv::Mat distCoeffs = cv::Mat::zeros(1, 5, CV_64F);
+    auto header = BinarySink::makeHeader(cv::Size(1280, 720), camParams, \
+                                         distCoeffs, cv::Scalar(198, 0, 0), \
+                                         cv::Scalar(255, 255, 255), \
+                                         cv::Scalar(165, 130, 130), \
+                                         cv::Scalar(255, 255, 255), 1.0);
+    {
+        BinarySink sinkObj(resultsPath, header);
+        for (int i = 0; i < 100; i++) {
+            LaneResult result;
+            result.frameIndex = i;
+            result.polygon = {cv::Point(i, 1), cv::Point(2, 3), \
+                              cv::Point(4, 5), cv::Point(6, 7)};
+            result.slopeLeft = -0.7;
+            result.turn = TURN_RIGHT;
+            result.status = STATUS_REUSED;
+            sinkObj.write(cv::Mat(), result);
+        }
+    }
+
+    LaneRecordReader readerObj;
+    ASSERT_TRUE(readerObj.open(resultsPath));
+    EXPECT_EQ(100u, readerObj.size());
+    EXPECT_EQ(1280u, readerObj.header().width);
+    EXPECT_EQ(header.calibrationHash, readerObj.header().calibrationHash);
+    const LaneRecord *record = readerObj.find(42);
+    ASSERT_TRUE(record != nullptr);
+    EXPECT_EQ(42, record->polygon[0]);
+    EXPECT_EQ(static_cast<uint32_t>(TURN_RIGHT), record->turn);
+    EXPECT_TRUE(readerObj.find(100) == nullptr);
+
+    auto result = BinarySink::toResult(*record);
+    EXPECT_EQ(cv::Point(42, 1), result.polygon.at(0));
+    EXPECT_EQ(STATUS_REUSED, static_cast<int>(result.status));
+    readerObj.close();
+    std::remove(resultsPath);
+}
+
+/************************************************
+*
+*  Next we test the ImageSequenceSource class
+*
+*************************************************/
+TEST(ImageSequenceSourceTest, OrderedPrefetchTest) {
+    std::vector<std::string> paths;
+    for (int i = 0; i < 12; i++) {
+        paths.push_back("ImageSequenceTest" + std::to_string(i) + ".png");
+        cv::imwrite(paths.back(), cv::Mat(8, 8, CV_8UC3, cv::Scalar::all(i)));
+    }
+
+    ImageSequenceSource sourceObj(paths, 3, 25.0, 4);
+    EXPECT_TRUE(sourceObj.isOpened());
+    EXPECT_EQ(cv::Size(8, 8), sourceObj.frameSize());
+    EXPECT_DOUBLE_EQ(25.0, sourceObj.fps());
+
+    // The workers decode out of order, but the frames come out in order
+    cv::Mat frame;
+    int count = 0;
+    while (sourceObj.read(frame)) {
+        EXPECT_EQ(count, frame.at<cv::Vec3b>(0, 0)[0]);
+        count++;
+    }
+    EXPECT_EQ(12, count);
+    sourceObj.release();
+
+    for (auto& path : paths) {
+        std::remove(path.c_str());
+    }
+}
+
+TEST(FrameEnumeratorTest, StreamingOrderTest) {
+    uint64_t key = 0;
+    EXPECT_TRUE(Files::frameKey("frame_0042.jpg", key));
+    EXPECT_EQ(42u, key);
+    EXPECT_TRUE(Files::frameKey("cam2_7.png", key));
+    EXPECT_EQ(7u, key);
+    // Timestamp numbers beyond the range of int keep their value
+    EXPECT_TRUE(Files::frameKey("ts_1539000000123.jpg", key));
+    EXPECT_EQ(1539000000123u, key);
+    EXPECT_FALSE(Files::frameKey("frame_99999999999999999999999.jpg", key));
+    EXPECT_FALSE(Files::frameKey(".DS_Store", key));
+    EXPECT_TRUE(Files::isImageFile("frame_0042.JPG"));
+    EXPECT_FALSE(Files::isImageFile("notes.txt"));
+
+    // Numbered frames in shuffled order mixed with files to be skipped
+    std::string folder = "FrameEnumeratorTest";
+    FS::create_directory(folder);
+    std::vector<int> numbers = {5, 1, 9, 3, 2, 8, 4, 7, 6, 10};
+    for (int number : numbers) {
+        std::ofstream(folder + "/frame_" + std::to_string(number) + ".jpg");
+    }
+    std::ofstream(folder + "/.DS_Store");
+    std::ofstream(folder + "/notes.txt");
+
+    FrameEnumerator framesObj(folder, 1);
+    std::string path;
+    uint64_t expected = 1;
+    while (framesObj.next(path)) {
+        EXPECT_TRUE(Files::frameKey(FS::path(path).filename().string(), key));
+        EXPECT_EQ(expected, key);
+        expected++;
+    }
+    EXPECT_EQ(11u, expected);
+    EXPECT_TRUE(framesObj.finished());
+    EXPECT_EQ(10u, framesObj.accepted());
+    EXPECT_EQ(2u, framesObj.skipped());
+    EXPECT_EQ(0u, framesObj.outOfOrder());
+
+    // Leaving before the listing is read ends it without waiting for it
+    {
+        FrameEnumerator early(folder, 1);
+        ASSERT_TRUE(early.next(path));
+    }
+
+    FS::remove_all(folder);
+}
+
+TEST(LaneConfigTest, StreamsFileTest) {
+    std::string address = "LaneConfigTest.yml";
+    {
+        cv::FileStorage file(address, cv::FileStorage::WRITE);
+        file << "streams" << "[";
+        file << "{" << "name" << "front" << "input" << "front.avi" \
+             << "process_scale" << 0.5 << "white_min" << "[" << 190 << 0 \
+             << 0 << "]" << "}";
+        file << "{" << "input" << "rear" << "roi" << "[" << 0.1 << 0.9 \
+             << 0.5 << 0.5 << 0.9 << 0.9 << "]" << "}";
+        file << "]";
+    }
+
+    std::string error;
+    std::vector<LaneConfig> streams = LaneConfig::loadStreams(address, error);
+    ASSERT_EQ(2u, streams.size());
+    EXPECT_EQ("front", streams[0].name);
+    EXPECT_EQ("front.avi", streams[0].input);
+    EXPECT_DOUBLE_EQ(0.5, streams[0].processScale);
+    EXPECT_DOUBLE_EQ(190, streams[0].whiteMin[0]);
+    EXPECT_DOUBLE_EQ(255, streams[0].whiteMax[0]);
+    EXPECT_EQ("stream1", streams[1].name);
+    EXPECT_EQ(3u, streams[1].roi.size());
+    EXPECT_EQ(cv::Size(1280, 720), streams[1].calibrationSize);
+
+    EXPECT_TRUE(LaneConfig::loadStreams("missing.yml", error).empty());
+    EXPECT_FALSE(error.empty());
+    std::remove(address.c_str());
+}
+
+TEST(LaneConfigTest, StreamsFileCamerasTest) {
+    std::string address = "LaneConfigCameras.yml";
+    cv::Mat frontCamera = (cv::Mat_<double>(3, 3) << 1000, 0, 640, \
+                           0, 1000, 360, 0, 0, 1);
+    cv::Mat rearCamera = (cv::Mat_<double>(3, 3) << 800, 0, 600, \
+                          0, 820, 340, 0, 0, 1);
+    cv::Mat frontCoeffs = (cv::Mat_<double>(1, 5) << -0.2, 0.1, 0, 0, 0);
+    cv::Mat rearCoeffs = (cv::Mat_<double>(1, 5) << -0.3, 0.05, 0.001, \
+                          0, 0.01);
+    {
+        cv::FileStorage file(address, cv::FileStorage::WRITE);
+        file << "streams" << "[";
+        file << "{" << "input" << "front.avi" << "camera_matrix" \
+             << frontCamera << "distortion" << frontCoeffs << "}";
+        file << "{" << "input" << "rear.avi" << "camera_matrix" \
+             << rearCamera << "distortion" << rearCoeffs << "}";
+        file << "]";
+    }
+
+    // Every stream keeps its own camera, and the base keeps the reference
+    LaneConfig base;
+    cv::Mat baseCamera = base.camParams.clone();
+    cv::Mat baseCoeffs = base.distCoeffs.clone();
+    std::string error;
+    std::vector<LaneConfig> streams = LaneConfig::loadStreams(address, \
+                                                              error, base);
+    ASSERT_EQ(2u, streams.size()) << error;
+    EXPECT_EQ(0, cv::norm(frontCamera, streams[0].camParams, cv::NORM_INF));
+    EXPECT_EQ(0, cv::norm(rearCamera, streams[1].camParams, cv::NORM_INF));
+    EXPECT_EQ(0, cv::norm(frontCoeffs, streams[0].distCoeffs, \
+                          cv::NORM_INF));
+    EXPECT_EQ(0, cv::norm(rearCoeffs, streams[1].distCoeffs, cv::NORM_INF));
+    EXPECT_EQ(0, cv::norm(baseCamera, base.camParams, cv::NORM_INF));
+    EXPECT_EQ(0, cv::norm(baseCoeffs.reshape(1, 1), \
+                          base.distCoeffs.reshape(1, 1), cv::NORM_INF));
+    std::remove(address.c_str());
+}
+
+TEST(LaneStreamTest, ReentrantChainTest) {
+    // White lane markings with slopes in the ranges LanesMarker accepts
+    cv::Mat frame = cv::Mat::zeros(720, 1280, CV_8UC3);
+    cv::line(frame, cv::Point(300, 704), cv::Point(600, 494), \
+             cv::Scalar::all(255), 8);
+    cv::line(frame, cv::Point(1100, 704), cv::Point(850, 454), \
+             cv::Scalar::all(255), 8);
+
+    // The chain objects are kept between frames and start over every time
+    LaneStream streamObj((LaneConfig()));
+    LaneResult first = streamObj.detect(frame, LaneStream::Quality());
+    LaneResult second = streamObj.detect(frame, LaneStream::Quality());
+    EXPECT_EQ(0, first.frameIndex);
+    EXPECT_EQ(1, second.frameIndex);
+    EXPECT_EQ(first.polygon, second.polygon);
+
+    LaneResult reused = streamObj.reuse(frame);
+    EXPECT_EQ(STATUS_REUSED, reused.status);
+    EXPECT_EQ(3, streamObj.frameCount());
+    EXPECT_EQ(4u, reused.polygon.size());
+}
+
+TEST(LaneStreamTest, BandedStagesTest) {
+    SceneGenerator::Settings scene;
+    scene.curvature = 0.04;
+    scene.shadows = 2;
+    scene.noise = 3;
+    SceneGenerator generator(scene);
+    SceneTruth truth;
+
+    // Bands of 7 rows cut through the 5x5 blur, auto bands fit the cache
+    LaneConfig banded, cached;
+    banded.bandRows = 7;
+    cached.bandRows = -1;
+    LaneStream stagedObj((LaneConfig())), bandedObj(banded), cachedObj(cached);
+    LaneStream::Quality quality, rough;
+    rough.smoothing = false;
+    for (long i = 0; i < 3; i++) {
+        cv::Mat frame = generator.render(i, truth);
+        const LaneStream::Quality& level = i == 2 ? rough : quality;
+        LaneResult staged = stagedObj.detect(frame, level);
+        LaneResult bandResult = bandedObj.detect(frame, level);
+        LaneResult cacheResult = cachedObj.detect(frame, level);
+        EXPECT_EQ(0, cv::norm(stagedObj.lanesMask(), bandedObj.lanesMask(), \
+                              cv::NORM_INF));
+        EXPECT_EQ(0, cv::norm(stagedObj.edges(), bandedObj.edges(), \
+                              cv::NORM_INF));
+        EXPECT_EQ(0, cv::norm(stagedObj.edges(), cachedObj.edges(), \
+                              cv::NORM_INF));
+        EXPECT_EQ(staged.polygon, bandResult.polygon);
+        EXPECT_EQ(staged.polygon, cacheResult.polygon);
+    }
+}
+
+TEST(ThreadPoolTest, PerStreamOrderTest) {
+    const int streams = 6, frames = 200;
+    std::vector<int> last(streams, -1);
+    std::atomic<int> total(0);
+    std::atomic<bool> ordered(true);
+    {
+        ThreadPool poolObj(4);
+        EXPECT_EQ(4, poolObj.size());
+        // Every stream queues its next frame when it is done with one
+        std::function<void(int, int)> step = [&](int stream, int frame) {
+            if (last[stream] != frame - 1)
+                ordered = false;
+            last[stream] = frame;
+            total++;
+            if (frame + 1 < frames)
+                poolObj.submit([&step, stream, frame] {
+                    step(stream, frame + 1);
+                });
+        };
+        for (int i = 0; i < streams; i++)
+            poolObj.submit([&step, i] { step(i, 0); });
+        poolObj.wait();
+    }
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(streams * frames, total);
+}
+
+TEST(LanePipelineTest, ZeroCopyViewTest) {
+    cv::Mat frame = cv::Mat::zeros(720, 1280, CV_8UC3);
+    cv::line(frame, cv::Point(300, 704), cv::Point(600, 494), \
+             cv::Scalar(255, 255, 255), 8);
+    cv::line(frame, cv::Point(1100, 704), cv::Point(850, 454), \
+             cv::Scalar(0, 230, 255), 8);
+
+    // A view of a region keeps the row stride of the whole frame
+    cv::Mat region = frame(cv::Rect(0, 0, 640, 720));
+    FrameView regionView = LanePipeline::view(region);
+    cv::Mat wrapped = LanePipeline::wrap(regionView);
+    EXPECT_EQ(region.data, wrapped.data);
+    EXPECT_EQ(frame.step, wrapped.step);
+    EXPECT_EQ(640, wrapped.cols);
+
+    // The same frame handed in as RGB gives the same lanes as BGR
+    cv::Mat rgb;
+    cv::cvtColor(frame, rgb, cv::COLOR_BGR2RGB);
+    FrameView rgbView = LanePipeline::view(rgb);
+    rgbView.format = PIXEL_RGB;
+    LanePipeline bgrPipeline((LanePipeline::Options()));
+    LanePipeline rgbPipeline((LanePipeline::Options()));
+    LaneResult bgrResult = bgrPipeline.process(LanePipeline::view(frame));
+    LaneResult rgbResult = rgbPipeline.process(rgbView);
+    EXPECT_TRUE(bgrPipeline.detected());
+    EXPECT_EQ(bgrResult.polygon, rgbResult.polygon);
+
+    // A view with a stride shorter than a row is rejected
+    FrameView broken = LanePipeline::view(frame);
+    broken.stride = 100;
+    EXPECT_TRUE(bgrPipeline.process(broken).polygon.empty());
+    EXPECT_FALSE(bgrPipeline.detected());
+}
+
+TEST(FrameRingTest, OverrunTest) {
+    std::string name = "lanes-test-" + std::to_string(getpid());
+    const int frames = 5000, width = 32, height = 24;
+    FrameRing producer;
+    ASSERT_TRUE(producer.create(name, 4, width * height * 3));
+    FrameRing reader;
+    ASSERT_TRUE(reader.attach(name));
+    EXPECT_EQ(4u, reader.slotCount());
+
+    // The stand-in producer never waits, so the slow reader below is
+    // overrun again and again
+    std::thread camera([&producer] {
+        std::vector<unsigned char> pixels(width * height * 3);
+        for (int i = 1; i <= frames; i++) {
+            std::fill(pixels.begin(), pixels.end(), \
+                      static_cast<unsigned char>(i));
+            FrameView view;
+            view.data = pixels.data();
+            view.width = width;
+            view.height = height;
+            producer.publish(view, i * 1000ULL);
+        }
+        producer.finish();
+    });
+    FrameView view;
+    FrameRing::FrameInfo info;
+    uint64_t accepted = 0, last = 0;
+    bool ordered = true, matching = true;
+    while (reader.next(view, info, 5.0)) {
+        bool same = info.timestampNs == info.sequence * 1000 && \
+                    view.width == width && view.height == height;
+        for (int row = 0; row < height && same; row++)
+            for (int col = 0; col < width * 3; col++)
+                same = same && view.data[row * view.stride + col] == \
+                       static_cast<unsigned char>(info.sequence);
+        if (info.sequence % 3 == 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        if (!reader.intact(info.sequence))
+            continue;
+        // Every frame which was still intact after use was read whole
+        ordered = ordered && info.sequence > last;
+        matching = matching && same;
+        last = info.sequence;
+        accepted++;
+    }
+    camera.join();
+    EXPECT_FALSE(reader.timedOut());
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(matching);
+    EXPECT_GT(accepted, 0u);
+    EXPECT_GT(reader.dropped(), 0u);
+    EXPECT_EQ(static_cast<uint64_t>(frames), \
+              accepted + reader.dropped() + reader.torn());
+
+    // Results travel back in order with the frame sequence
+    ResultRing results;
+    ASSERT_TRUE(results.create(name + "-results", 8));
+    ResultRing resultReader;
+    ASSERT_TRUE(resultReader.attach(name + "-results"));
+    EXPECT_FALSE(reader.attach(name + "-results"));
+    for (uint64_t i = 1; i <= 3; i++) {
+        LaneRecord record = LaneRecord();
+        record.frameIndex = i;
+        results.publish(record, i * 1000);
+    }
+    results.finish();
+    LaneRecord record;
+    uint64_t timestampNs;
+    for (uint64_t i = 1; i <= 3; i++) {
+        ASSERT_TRUE(resultReader.next(record, timestampNs, 1.0));
+        EXPECT_EQ(i, record.frameIndex);
+        EXPECT_EQ(i * 1000, timestampNs);
+    }
+    EXPECT_FALSE(resultReader.next(record, timestampNs, 1.0));
+}
+
+TEST(LaneServerTest, ConcurrentClientsTest) {
+    std::string folder = "LaneServerTest";
+    FS::create_directory(folder);
+    for (int i = 1; i <= 6; i++) {
+        cv::imwrite(folder + "/" + std::to_string(i) + ".png", \
+                    cv::Mat::zeros(72, 128, CV_8UC3));
+    }
+    std::ostringstream log;
+    LaneServer::Options options;
+    options.socketPath = "LaneServerTest.sock";
+    options.threads = 2;
+    options.log = &log;
+    LaneServer serverObj(options);
+    ASSERT_TRUE(serverObj.start());
+    LaneServer secondObj(options);
+    EXPECT_FALSE(secondObj.start());
+
+    // Every client sends all its requests, closes its sending side and
+    // reads the replies until the server closes the connection
+    auto talk = [&options](const std::string& requests) {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, options.socketPath.c_str(), \
+                     sizeof(address.sun_path) - 1);
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        std::string replies;
+        if (connect(fd, reinterpret_cast<sockaddr*>(&address), \
+                    sizeof(address)) == 0) {
+            send(fd, requests.data(), requests.size(), 0);
+            shutdown(fd, SHUT_WR);
+            char chunk[1024];
+            ssize_t count;
+            while ((count = recv(fd, chunk, sizeof(chunk), 0)) > 0)
+                replies.append(chunk, static_cast<size_t>(count));
+        }
+        close(fd);
+        return replies;
+    };
+    std::vector<std::string> replies(3);
+    std::vector<std::thread> clients;
+    for (int i = 0; i < 3; i++) {
+        clients.push_back(std::thread([&replies, &talk, &folder, i] {
+            replies[i] = talk("FILE " + folder + "\nFILE missing.avi\n"
+                              "FILE " + folder + "\n");
+        }));
+    }
+    for (auto& client : clients)
+        client.join();
+
+    // The replies of every client come in request and frame order
+    for (auto& reply : replies) {
+        std::istringstream lines(reply);
+        std::vector<std::string> kinds;
+        std::string line, kind;
+        unsigned long job, expectedJob = 1;
+        long frame, expectedFrame = 0;
+        while (std::getline(lines, line)) {
+            std::istringstream fields(line);
+            fields >> kind >> job;
+            EXPECT_EQ(expectedJob, job);
+            if (kind == "FRAME") {
+                fields >> frame;
+                EXPECT_EQ(expectedFrame++, frame);
+                continue;
+            }
+            kinds.push_back(kind);
+            expectedJob++;
+            expectedFrame = 0;
+        }
+        EXPECT_EQ(std::vector<std::string>({"DONE", "ERROR", "DONE"}), kinds);
+        EXPECT_NE(std::string::npos, reply.find("DONE 1 6 "));
+    }
+    serverObj.stop();
+    EXPECT_EQ(6u, serverObj.jobsDone());
+    EXPECT_FALSE(FS::exists(options.socketPath));
+    FS::remove_all(folder);
+}
+
+TEST(FrameCacheSourceTest, DecodeOnceAndMapTest) {
+    std::vector<std::string> paths;
+    for (int i = 0; i < 5; i++) {
+        paths.push_back("FrameCacheTest" + std::to_string(i) + ".png");
+        cv::imwrite(paths.back(), cv::Mat(30, 50, CV_8UC3, \
+                                          cv::Scalar(i, 2 * i, 3 * i)));
+    }
+    ImageSequenceSource decoder(paths, 2, 25.0);
+    std::string error;
+    EXPECT_EQ(5, FrameCacheSource::build(decoder, "FrameCacheTest.lraw", \
+                                         error));
+    EXPECT_TRUE(FrameCacheSource::isCache("FrameCacheTest.lraw"));
+    EXPECT_FALSE(FrameCacheSource::isCache(paths.front()));
+
+    // Every frame is read in place from a page aligned offset
+    FrameCacheSource sourceObj("FrameCacheTest.lraw");
+    ASSERT_TRUE(sourceObj.isOpened());
+    EXPECT_EQ(5u, sourceObj.size());
+    EXPECT_EQ(cv::Size(50, 30), sourceObj.frameSize());
+    EXPECT_DOUBLE_EQ(25.0, sourceObj.fps());
+    cv::Mat frame, first;
+    int count = 0;
+    while (sourceObj.read(frame)) {
+        if (count == 0)
+            first = frame;
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(frame.data) % 4096);
+        EXPECT_EQ(cv::Vec3b(count, 2 * count, 3 * count), \
+                  frame.at<cv::Vec3b>(29, 49));
+        count++;
+    }
+    EXPECT_EQ(5, count);
+
+    // Drawing on a frame leaves the file alone
+    first.setTo(cv::Scalar::all(255));
+    FrameCacheSource secondObj("FrameCacheTest.lraw");
+    ASSERT_TRUE(secondObj.read(frame));
+    EXPECT_EQ(cv::Vec3b(0, 0, 0), frame.at<cv::Vec3b>(0, 0));
+    sourceObj.rewind();
+    ASSERT_TRUE(sourceObj.read(frame));
+    EXPECT_EQ(cv::Vec3b(255, 255, 255), frame.at<cv::Vec3b>(0, 0));
+
+    // A file without its index is rejected
+    sourceObj.release();
+    secondObj.release();
+    FS::resize_file("FrameCacheTest.lraw", 4096);
+    FrameCacheSource brokenObj("FrameCacheTest.lraw");
+    EXPECT_FALSE(brokenObj.isOpened());
+
+    std::remove("FrameCacheTest.lraw");
+    for (auto& path : paths) {
+        std::remove(path.c_str());
+    }
+}
+
+TEST(SceneGeneratorTest, DeterministicTruthTest) {
+    SceneGenerator::Settings settings;
+    settings.size = cv::Size(640, 360);
+    settings.curvature = 0.05;
+    settings.shadows = 2;
+    settings.noise = 4;
+    SceneGenerator generator(settings);
+    SceneTruth truth, again;
+    cv::Mat frame = generator.render(12, truth);
+    EXPECT_EQ(0, cv::norm(frame, generator.render(12, again), cv::NORM_INF));
+    EXPECT_EQ(12, truth.frameIndex);
+    ASSERT_FALSE(truth.left.empty());
+    ASSERT_EQ(truth.left.size(), truth.right.size());
+    EXPECT_DOUBLE_EQ(359, truth.left.back().y);
+    for (size_t i = 0; i < truth.left.size(); i++) {
+        EXPECT_LT(truth.left[i].x, truth.right[i].x);
+        EXPECT_GE(truth.left[i].x, 0);
+        EXPECT_LT(truth.right[i].x, 640);
+    }
+    ASSERT_GT(truth.left.size(), 2u);
+    const cv::Point2d& upper = truth.left[1];
+    const cv::Point2d& lower = truth.left[2];
+    EXPECT_NEAR(upper.x, SceneTruth::xAt(truth.left, upper.y), 1e-9);
+    EXPECT_NEAR((upper.x + lower.x) / 2, \
+                SceneTruth::xAt(truth.left, (upper.y + lower.y) / 2), 1e-9);
+    EXPECT_TRUE(std::isnan(SceneTruth::xAt(truth.left, 0)));
+
+    // Without distortion and noise the truth lies on the marking
+    settings.distort = false;
+    settings.noise = 0;
+    settings.shadows = 0;
+    SceneGenerator plain(settings);
+    frame = plain.render(0, truth);
+    cv::Point bottom(cvRound(truth.left.back().x), 359);
+    EXPECT_EQ(cv::Vec3b(20, 190, 240), frame.at<cv::Vec3b>(bottom));
+
+    // The detector finds the lane of a distorted 720p drive
+    SceneSource drive((SceneGenerator::Settings()), 3);
+    LanePipeline pipelineObj((LanePipeline::Options()));
+    LaneResult result;
+    int count = 0;
+    while (drive.read(frame)) {
+        result = pipelineObj.process(LanePipeline::view(frame));
+        count++;
+    }
+    EXPECT_EQ(3, count);
+    EXPECT_EQ(2, drive.truth().frameIndex);
+    EXPECT_EQ(4u, result.polygon.size());
+}
+
+TEST(LaneRegressionTest, GoldenRoundTripTest) {
+    std::ofstream suite("RegressionTest.yml");
+    suite << "%YAML:1.0\nclips:\n"
+          << "   - name: tiny\n"
+          << "     scene: { width: 320, height: 180, noise: 2, seed: 5 }\n"
+          << "     frames: 6\n"
+          << "     golden: RegressionTest/tiny.lres\n"
+          << "   - name: footage\n"
+          << "     input: RegressionTestMissing.mp4\n"
+          << "     golden: RegressionTest/footage.lres\n";
+    suite.close();
+    std::string error;
+    std::vector<LaneRegression::Clip> clips = \
+        LaneRegression::loadSuite("RegressionTest.yml", error);
+    ASSERT_EQ(2u, clips.size()) << error;
+    EXPECT_TRUE(clips[0].synthetic);
+    EXPECT_EQ(cv::Size(320, 180), clips[0].scene.size);
+
+    // Missing golden results fail until they are recorded, after which the
+    // clip matches them
+    FS::remove_all("RegressionTest");
+    LaneRegression::Report report = LaneRegression::run(clips[0], false);
+    EXPECT_EQ(LaneRegression::FAILED, report.verdict);
+    EXPECT_FALSE(FS::exists(clips[0].golden));
+    report = LaneRegression::run(clips[0], true);
+    EXPECT_EQ(LaneRegression::RECORDED, report.verdict);
+    report = LaneRegression::run(clips[0], false);
+    EXPECT_EQ(LaneRegression::PASSED, report.verdict) << report.message;
+    EXPECT_EQ(6, report.frames);
+    EXPECT_EQ(0, report.mismatched);
+    EXPECT_DOUBLE_EQ(0, report.maxPolygonDelta);
+    EXPECT_EQ(report.stages.frames, 6);
+    EXPECT_GT(report.seconds, 0);
+    EXPECT_EQ(LaneRegression::SKIPPED, \
+              LaneRegression::run(clips[1], false).verdict);
+
+    // Golden results with fewer frames fail the clip
+    clips[0].frames = 5;
+    EXPECT_EQ(LaneRegression::FAILED, \
+              LaneRegression::run(clips[0], false).verdict);
+
+    // A moved vertex and a lost lane line are measured
+    LaneRecord golden, actual;
+    std::memset(&golden, 0, sizeof(golden));
+    golden.leftLine[0] = std::numeric_limits<float>::quiet_NaN();
+    actual = golden;
+    actual.polygon[2] = 3;
+    actual.polygon[3] = 4;
+    double lineDelta, polygonDelta;
+    LaneRegression::compare(golden, actual, lineDelta, polygonDelta);
+    EXPECT_DOUBLE_EQ(0, lineDelta);
+    EXPECT_DOUBLE_EQ(5, polygonDelta);
+    actual.leftLine[0] = 1;
+    LaneRegression::compare(golden, actual, lineDelta, polygonDelta);
+    EXPECT_TRUE(std::isinf(lineDelta));
+
+    std::remove("RegressionTest/tiny.lres");
+    std::remove("RegressionTest");
+    std::remove("RegressionTest.yml");
+}
+
+TEST(LaneTunerTest, ParetoConfigTest) {
+    std::vector<LaneTuner::Candidate> candidates(4);
+    candidates[0].fps = 20;
+    candidates[0].error = 0.5;
+    candidates[1].fps = 40;
+    candidates[1].error = 1.5;
+    candidates[1].levels[0] = 2;
+    candidates[2].fps = 30;
+    candidates[2].error = 2.0;
+    candidates[3].fps = 60;
+    candidates[3].error = 4.0;
+    candidates[3].levels[0] = 4;
+    candidates[3].levels[6] = 3;
+    for (auto& candidate : candidates)
+        candidate.frames = 10;
+
+    // The third candidate is slower and worse than the second one
+    std::vector<LaneTuner::Candidate> front = \
+        LaneTuner::paretoFront(candidates);
+    ASSERT_EQ(3u, front.size());
+    EXPECT_DOUBLE_EQ(60, front[0].fps);
+    EXPECT_DOUBLE_EQ(20, front[2].fps);
+    EXPECT_DOUBLE_EQ(40, LaneTuner::choose(front, 30).fps);
+    EXPECT_DOUBLE_EQ(60, LaneTuner::choose(front, 100).fps);
+
+    // The chosen settings are what the detector loads with --config
+    ASSERT_TRUE(LaneTuner::write("TunerTest.yml", front[0], front, 50));
+    LaneConfig config, expected;
+    front[0].apply(expected);
+    std::string error;
+    ASSERT_TRUE(config.loadFile("TunerTest.yml", error)) << error;
+    EXPECT_DOUBLE_EQ(0.25, config.processScale);
+    EXPECT_EQ(40, config.houghThreshold);
+    EXPECT_EQ(expected.gaussKernel, config.gaussKernel);
+    EXPECT_DOUBLE_EQ(expected.cannyHigh, config.cannyHigh);
+    EXPECT_NEAR(expected.houghTheta, config.houghTheta, 1e-9);
+    std::remove("TunerTest.yml");
+
+    // Accuracy is the distance from the true lanes, not from the defaults
+    SceneTruth truth;
+    truth.left = {cv::Point2d(400, 400), cv::Point2d(200, 719)};
+    truth.right = {cv::Point2d(800, 400), cv::Point2d(1000, 719)};
+    LaneResult onLanes;
+    onLanes.polygon = {cv::Point(400, 400), cv::Point(800, 400), \
+                       cv::Point(1000, 719), cv::Point(200, 719)};
+    EXPECT_NEAR(0, LaneTuner::truthError(onLanes, truth, 320), 1e-9);
+    LaneResult shifted = onLanes;
+    for (auto& vertex : shifted.polygon)
+        vertex.x += 6;
+    EXPECT_NEAR(6, LaneTuner::truthError(shifted, truth, 320), 1e-9);
+    LaneResult missed;
+    missed.polygon.assign(4, cv::Point(0, 0));
+    EXPECT_DOUBLE_EQ(320, LaneTuner::truthError(missed, truth, 320));
+    EXPECT_DOUBLE_EQ(320, LaneTuner::truthError(LaneResult(), truth, 320));
+
+    // Malformed settings are rejected
+    std::ofstream broken("TunerTest.yml");
+    broken << "%YAML:1.0\ncanny: [ 45, 15 ]\n";
+    broken.close();
+    EXPECT_FALSE(config.loadFile("TunerTest.yml", error));
+    std::remove("TunerTest.yml");
+}
+
+TEST(PixelStagesTest, FusedMaskTest) {
+    cv::Mat bgr(61, 97, CV_8UC3);
+    cv::randu(bgr, cv::Scalar::all(0), cv::Scalar::all(256));
+    cv::Mat roi = cv::Mat::zeros(bgr.size(), CV_8U);
+    cv::circle(roi, cv::Point(48, 30), 25, cv::Scalar(1), -1);
+
+    // The fused pass gives the masks of the separate stages
+    Thresholder thresholdObj(cv::Scalar(120, 0, 0), \
+                             cv::Scalar(255, 255, 255), \
+                             cv::Scalar(60, 130, 130), \
+                             cv::Scalar(255, 255, 255));
+    thresholdObj.convertToLab(bgr);
+    thresholdObj.whiteMaskFunc();
+    thresholdObj.yellowMaskFunc();
+    cv::Mat staged = thresholdObj.combineLanes();
+    cv::Mat stagedInside = cv::Mat::zeros(bgr.size(), CV_8U);
+    staged.copyTo(stagedInside, roi);
+    cv::Mat lanes, inside;
+    thresholdObj.maskRows(bgr, roi, lanes, inside);
+    EXPECT_GT(cv::countNonZero(staged), 0);
+    EXPECT_EQ(0, cv::norm(staged, lanes, cv::NORM_INF));
+    EXPECT_EQ(0, cv::norm(stagedInside, inside, cv::NORM_INF));
+
+    // Over all the rows of a whole frame, as LaneStream masks it without
+    // bands, the fused pass still gives the masks of the separate stages
+    cv::Mat frame(720, 1280, CV_8UC3);
+    cv::randu(frame, cv::Scalar::all(0), cv::Scalar::all(256));
+    cv::Mat frameRoi = cv::Mat::zeros(frame.size(), CV_8U);
+    std::vector<cv::Point> corners = {cv::Point(150, 720), \
+        cv::Point(590, 450), cv::Point(690, 450), cv::Point(1200, 720)};
+    cv::fillConvexPoly(frameRoi, corners, cv::Scalar(1));
+    thresholdObj.convertToLab(frame);
+    thresholdObj.whiteMaskFunc();
+    thresholdObj.yellowMaskFunc();
+    staged = thresholdObj.combineLanes();
+    stagedInside = cv::Mat::zeros(frame.size(), CV_8U);
+    staged.copyTo(stagedInside, frameRoi);
+    thresholdObj.maskRows(frame, frameRoi, lanes, inside);
+    EXPECT_EQ(0, cv::norm(staged, lanes, cv::NORM_INF));
+    EXPECT_EQ(0, cv::norm(stagedInside, inside, cv::NORM_INF));
+
+    // A third range on 16 bit single channel pixels is one more test
+    cv::Mat depth(40, 50, CV_16U);
+    cv::randu(depth, cv::Scalar(0), cv::Scalar(4000));
+    auto rule = anyOf(PixelRange<ushort, 1>(cv::Scalar(100), cv::Scalar(900)), \
+                      PixelRange<ushort, 1>(cv::Scalar(1500), \
+                                            cv::Scalar(1600)), \
+                      PixelRange<ushort, 1>(cv::Scalar(3000.5), \
+                                            cv::Scalar(3999.5)));
+    cv::Mat expected, part;
+    cv::inRange(depth, cv::Scalar(100), cv::Scalar(900), expected);
+    cv::inRange(depth, cv::Scalar(1500), cv::Scalar(1600), part);
+    cv::bitwise_or(expected, part, expected);
+    cv::inRange(depth, cv::Scalar(3000.5), cv::Scalar(3999.5), part);
+    cv::bitwise_or(expected, part, expected);
+    cv::Mat mask, all;
+    ASSERT_TRUE(fuseMask(depth, KeepPixels(), rule, cv::Mat(), mask, all));
+    EXPECT_EQ(0, cv::norm(expected, mask, cv::NORM_INF));
+    EXPECT_EQ(0, cv::norm(expected, all, cv::NORM_INF));
+
+    // Pixels of another layout than the rule are refused
+    EXPECT_FALSE(fuseMask(bgr, KeepPixels(), rule, cv::Mat(), mask, all));
+}
+
+TEST(LaneFitterTest, SlidingWindowTest) {
+    // A solid left lane and a dashed right lane curving to the left
+    auto drawLanes = [](int shift) -> cv::Mat {
+        cv::Mat mask = cv::Mat::zeros(360, 320, CV_8U);
+        for (int row = 0; row < mask.rows; ++row) {
+            int bend = cvRound(2e-4 * (row - 360) * (row - 360));
+            cv::line(mask, cv::Point(70 + bend + shift - 3, row), \
+                     cv::Point(70 + bend + shift + 2, row), cv::Scalar(255));
+            if ((row / 30) % 2 == 0) {
+                cv::line(mask, cv::Point(250 + bend + shift - 3, row), \
+                         cv::Point(250 + bend + shift + 2, row), \
+                         cv::Scalar(255));
+            }
+        }
+        return mask;
+    };
+    LaneFitter fitter;
+    ASSERT_TRUE(fitter.fit(drawLanes(0)));
+    EXPECT_TRUE(fitter.searched());
+    for (int row : {0, 180, 359}) {
+        double bend = 2e-4 * (row - 360) * (row - 360);
+        EXPECT_NEAR(69.5 + bend, LaneFitter::evaluate(fitter.left(), row), 1);
+        EXPECT_NEAR(249.5 + bend, LaneFitter::evaluate(fitter.right(), row), \
+                    1);
+    }
+
+    // A tracked lane is only searched near the previous fit
+    ASSERT_TRUE(fitter.fit(drawLanes(4)));
+    EXPECT_FALSE(fitter.searched());
+    EXPECT_NEAR(73.5, LaneFitter::evaluate(fitter.left(), 359), 1);
+
+    // Without lanes the fits of the last frame are kept
+    EXPECT_FALSE(fitter.fit(cv::Mat::zeros(360, 320, CV_8U)));
+    EXPECT_FALSE(fitter.tracking());
+    EXPECT_NEAR(73.5, LaneFitter::evaluate(fitter.left(), 359), 1);
+
+    // Exact pixels of a parabola give its coefficients back
+    std::vector<cv::Point> pixels;
+    for (int row = 10; row < 200; row += 10)
+        pixels.push_back(cv::Point(row * row / 10 - 3 * row + 40, row));
+    cv::Vec3d coeffs;
+    ASSERT_TRUE(LaneFitter::fitPolynomial(pixels, coeffs));
+    EXPECT_NEAR(0.1, coeffs[0], 1e-9);
+    EXPECT_NEAR(-3, coeffs[1], 1e-7);
+    EXPECT_NEAR(40, coeffs[2], 1e-5);
+    pixels.resize(2);
+    EXPECT_FALSE(LaneFitter::fitPolynomial(pixels, coeffs));
+}
+
+TEST(CheckpointTest, ResumeIdenticalTest) {
+    SceneGenerator::Settings scene;
+    scene.curvature = 0.03;
+    scene.noise = 2;
+    SceneGenerator generator(scene);
+    SceneTruth truth;
+    std::vector<cv::Mat> frames;
+    for (long i = 0; i < 6; i++)
+        frames.push_back(generator.render(i, truth));
+    LanePipeline::Options options;
+    options.gate = true;
+    auto readAll = [](const char *path) -> std::string {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream text;
+        text << file.rdbuf();
+        return text.str();
+    };
+
+    // The uninterrupted run
+    std::vector<LaneResult> expected;
+    {
+        LanePipeline whole(options);
+        OutputWriter writer;
+        writer.addSink(std::unique_ptr<ResultSink>(new CsvSink( \
+                       "CheckpointWhole.csv")));
+        for (auto& frame : frames) {
+            expected.push_back(whole.process(LanePipeline::view(frame)));
+            writer.push(cv::Mat(), expected.back());
+        }
+    }
+
+    // A run stopped one frame after its checkpoint at the third frame
+    Checkpoint saved;
+    {
+        LanePipeline first(options);
+        OutputWriter writer;
+        writer.addSink(std::unique_ptr<ResultSink>(new CsvSink( \
+                       "CheckpointResumed.csv")));
+        for (int i = 0; i < 4; i++) {
+            if (i == 3) {
+                saved.input = "drive";
+                saved.settings = first.settingsHash();
+                saved.frames = 3;
+                Checkpoint::Output results;
+                results.path = "CheckpointResumed.csv";
+                results.bytes = writer.positions().front();
+                saved.outputs.push_back(results);
+                saved.pipeline = first.state();
+            }
+            writer.push(cv::Mat(), first.process(LanePipeline::view( \
+                                                 frames[i])));
+        }
+    }
+    std::string error;
+    ASSERT_TRUE(saved.save("CheckpointTest.yml", error)) << error;
+    Checkpoint loaded;
+    ASSERT_TRUE(loaded.load("CheckpointTest.yml", error)) << error;
+
+    // Only the same input, settings and outputs continue the checkpoint
+    LanePipeline resumed(options);
+    std::vector<std::string> outputs = {"CheckpointResumed.csv"};
+    EXPECT_TRUE(loaded.matches("drive", resumed.settingsHash(), outputs, \
+                               error)) << error;
+    EXPECT_FALSE(loaded.matches("other", resumed.settingsHash(), outputs, \
+                                error));
+    LanePipeline::Options ungated;
+    EXPECT_NE(resumed.settingsHash(), LanePipeline(ungated).settingsHash());
+
+    // The resumed frames and results file are those of the whole run
+    resumed.restore(loaded.pipeline);
+    {
+        OutputWriter writer;
+        writer.addSink(std::unique_ptr<ResultSink>(new CsvSink( \
+                       "CheckpointResumed.csv", loaded.outputs[0].bytes)));
+        for (size_t i = 3; i < frames.size(); i++) {
+            LaneResult result = resumed.process(LanePipeline::view( \
+                                                frames[i]));
+            EXPECT_EQ(expected[i].frameIndex, result.frameIndex);
+            EXPECT_EQ(expected[i].status, result.status);
+            EXPECT_EQ(expected[i].polygon, result.polygon);
+            writer.push(cv::Mat(), result);
+        }
+    }
+    EXPECT_EQ(readAll("CheckpointWhole.csv"), \
+              readAll("CheckpointResumed.csv"));
+    EXPECT_EQ(expected.back().frameIndex + 1, \
+              resumed.stream().frameCount());
+    std::remove("CheckpointWhole.csv");
+    std::remove("CheckpointResumed.csv");
+    std::remove("CheckpointTest.yml");
+}
+
+TEST(ResultCacheTest, ChunkRoundTripTest) {
+    SceneGenerator::Settings scene;
+    scene.curvature = 0.03;
+    scene.noise = 2;
+    SceneGenerator generator(scene);
+    SceneTruth truth;
+    LanePipeline::Options options;
+    options.gate = true;
+    LanePipeline pipeline(options);
+    std::vector<LaneResult> results;
+    std::vector<LanePipeline::State> states;
+    for (long i = 0; i < 5; i++) {
+        results.push_back(pipeline.process(LanePipeline::view( \
+                          generator.render(i, truth))));
+        states.push_back(pipeline.state());
+    }
+
+    std::string folder = "ResultCacheTest";
+    FS::remove_all(folder);
+    ResultCache cache(folder, 1 << 30, 2);
+    std::ofstream("ResultCacheClip.bin") << "clip";
+    uint64_t content = 0;
+    ASSERT_TRUE(ResultCache::contentHash("ResultCacheClip.bin", content));
+    std::string key = cache.key(content, pipeline.settingsHash(), 0);
+    EXPECT_NE(key, cache.key(content, pipeline.settingsHash(), 1));
+    EXPECT_NE(key, ResultCache(folder, 1 << 30, 3).key(content, \
+              pipeline.settingsHash(), 0));
+
+    // Chunks of two frames and the last one of a single frame
+    for (long first = 0; first < 5; first += 2) {
+        size_t last = std::min<size_t>(first + 2, results.size());
+        std::vector<LaneResult> chunk(results.begin() + first, \
+                                      results.begin() + last);
+        ASSERT_TRUE(cache.store(key, first, chunk, states[last - 1]));
+    }
+    EXPECT_EQ(-1, cache.frames(key));
+    cache.complete(key, 5);
+    EXPECT_EQ(5, cache.frames(key));
+
+    std::vector<LaneResult> cached;
+    LanePipeline::State state;
+    EXPECT_FALSE(cache.find(key, 1, cached, state));
+    ASSERT_TRUE(cache.find(key, 2, cached, state));
+    ASSERT_EQ(2u, cached.size());
+    for (size_t i = 0; i < cached.size(); i++) {
+        EXPECT_EQ(results[2 + i].frameIndex, cached[i].frameIndex);
+        EXPECT_EQ(results[2 + i].leftLine, cached[i].leftLine);
+        EXPECT_EQ(results[2 + i].rightLine, cached[i].rightLine);
+        EXPECT_EQ(results[2 + i].polygon, cached[i].polygon);
+        EXPECT_EQ(results[2 + i].slopeLeft, cached[i].slopeLeft);
+        EXPECT_EQ(results[2 + i].turn, cached[i].turn);
+        EXPECT_EQ(results[2 + i].status, cached[i].status);
+    }
+    EXPECT_EQ(states[3].lanes.counter, state.lanes.counter);
+    EXPECT_EQ(states[3].gated, state.gated);
+
+    // A cache of half the size keeps only the chunk read last
+    uintmax_t size = 0;
+    for (FS::recursive_directory_iterator it(folder), end; it != end; ++it) {
+        if (FS::is_regular_file(it->path()))
+            size += FS::file_size(it->path());
+    }
+    ResultCache small(folder, size / 2, 2);
+    for (std::string first : {"0", "4"}) {
+        FS::last_write_time(FS::path(folder) / key / (first + ".lanes"), 1);
+        FS::last_write_time(FS::path(folder) / key / (first + ".yml"), 1);
+    }
+    EXPECT_EQ(2, small.evict());
+    EXPECT_TRUE(small.find(key, 2, cached, state));
+    EXPECT_FALSE(small.find(key, 0, cached, state));
+    EXPECT_EQ(-1, small.frames(key));
+    FS::remove_all(folder);
+    std::remove("ResultCacheClip.bin");
+}
+
+TEST(CoreSchedulerTest, CorePlanTest) {
+    std::vector<int> cores;
+    ASSERT_TRUE(CoreScheduler::parseCores("4-6,0,5", cores));
+    EXPECT_EQ(std::vector<int>({0, 4, 5, 6}), cores);
+    std::vector<int> unchanged = cores;
+    EXPECT_FALSE(CoreScheduler::parseCores("3-1", cores));
+    EXPECT_FALSE(CoreScheduler::parseCores("a,2", cores));
+    EXPECT_FALSE(CoreScheduler::parseCores("", cores));
+    EXPECT_EQ(unchanged, cores);
+
+    // A quarter of the budgeted cores, at least one, is auxiliary
+    CoreScheduler eight({0, 1, 2, 3, 4, 5, 6, 7}, 0);
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 4, 5}), eight.detection());
+    EXPECT_EQ(std::vector<int>({6, 7}), eight.auxiliary());
+    EXPECT_EQ(6, eight.opencvThreads(false));
+    EXPECT_EQ(0, eight.opencvThreads(true));
+    CoreScheduler budget({2, 3, 8, 9}, 3);
+    EXPECT_EQ(std::vector<int>({2, 3}), budget.detection());
+    EXPECT_EQ(std::vector<int>({8}), budget.auxiliary());
+    CoreScheduler single({5}, 4);
+    EXPECT_EQ(single.detection(), single.auxiliary());
+
+    // Pool workers pin themselves to their core
+    std::vector<int> available = CoreScheduler::available();
+    ASSERT_FALSE(available.empty());
+#ifdef __linux__
+    std::atomic<int> pinned(0);
+    {
+        ThreadPool pool(2, std::vector<int>(1, available.front()));
+        for (int i = 0; i < 4; i++) {
+            pool.submit([&pinned, &available] {
+                if (sched_getcpu() == available.front())
+                    pinned++;
+            });
+        }
+    }
+    EXPECT_EQ(4, pinned.load());
+#endif
+    std::stringstream report;
+    CoreScheduler all(available, 0);
+    all.start();
+    all.report(report);
+    EXPECT_NE(std::string::npos, report.str().find("Core "));
+}